@@ -0,0 +1,1092 @@
+// Filename:            EffectsPedal_audio.c
+//
+// Description:         Audio path of the effects pedal. Samples from the audio ADC are
+//                      collected into ping-pong frames by audioIn_hwi, processed a frame
+//                      at a time by the selected effect in audioOut_swi and played back
+//                      to the DAC by audioIn_hwi one frame later.
+//                      This file only touches peripheral registers, the Swi module and the
+//                      thread profiler, so it also builds on the host against the
+//                      stand-ins in host/.
+//
+// Target:              TMS320F28379D
+//
+// Date:                2021-11-17
+
+
+//defines:
+#define xdc__strict //suppress typedef warnings
+
+//includes:
+#include <xdc/std.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <Headers/F2837xD_device.h>
+#include <math.h>
+#include <bandpass_coeffs.h>
+#include <cab_ir.h>
+#include <partconv.h>
+#include <effect_chain.h>
+#include <thread_prof.h>
+#include <trace.h>
+#include <EffectsPedal_audio.h>
+
+//Swi Handle defined in .cfg file:
+extern const Swi_Handle audioOut_swi_handle;
+
+//Declare global variables:
+volatile Bool wahFlag = FALSE; // Flag used by wah effect to increment BPF frequency
+volatile Bool wahTickFlag = FALSE; // Set every tick, used by the morphing wah
+volatile UInt16 wahIndex = 0; // Index used by wah effect to increment BPF
+volatile Int16 wahDirection = 1; // Direction to increment BPF frequency
+volatile UInt16 effectKnob_result = 0; // Current position of Effect potentiometer
+volatile UInt16 effectKnob_results[10] = { 0 }; // Buffer used to average position of effect pot
+
+/* ---- Declare Buffer ---- */
+// Short delays and FIR windows; cleared by audio_init(). Delays longer
+// than fit in .ebss go through delay_mem in RAMGS.
+static Int16 sample_buffer[buffer_length + DELAY_MIRROR_LEN];
+static delay_long echo_line; // Feedback delay of effect_echo
+static Int32 echo_lp; // State of effect_echo's loop lowpass
+static Int32 audio_dc; // Input DC estimate, Q15 scaled by 2^AUDIO_DC_BITS
+static conv_part cab_conv; // Cabinet convolution of effect_cab
+delay_line audio_line = { sample_buffer, buffer_length, 0 };
+delay_line *audio_in = &audio_line;
+
+// The wah reads N - 1 + AUDIO_FRAME_LEN samples through one pointer
+#if N - 1 + AUDIO_FRAME_LEN > DELAY_MIRROR_LEN
+#error "DELAY_MIRROR_LEN is shorter than the wah window"
+#endif
+
+#if N - 1 > DELAY_MAX(CHAIN_SHORT_LEN, AUDIO_FRAME_LEN)
+#error "CHAIN_SHORT_LEN is too short for the wah window"
+#endif
+
+#if CONV_SEGS(CAB_MAX_TAPS) > CAB_SEGS
+#error "CAB_SEGS is too small for a CAB_MAX_TAPS cabinet IR"
+#endif
+
+#if CAB_IR_LEN > CAB_MAX_TAPS
+#error "The cabinet IR is longer than CAB_MAX_TAPS"
+#endif
+
+/* ---- Declare Frames ---- */
+// audioIn_hwi fills one half of audio_inFrame and plays one half of
+// audio_outFrame while audioOut_swi processes the other half.
+volatile UInt16 audio_inFrame[2][AUDIO_FRAME_LEN] = { 0 };
+volatile UInt16 audio_outFrame[2][AUDIO_FRAME_LEN] = { 0 }; // DAC codes
+volatile UInt16 frame_i = 0; // Position of audioIn_hwi within the current frame
+volatile UInt16 frame_half = 0; // Half audioIn_hwi is filling/playing
+volatile UInt16 frame_ready = 0; // Half handed to audioOut_swi
+
+static Bool dma_primed = FALSE; // Set once the DMA has started its first frame
+
+volatile audio_stats audio_stat; // See EffectsPedal_audio.h
+volatile audio_latency audio_lat;
+
+/* ---- Coefficient-morphing wah ---- */
+static Float h_morph[N/2]; // Blend of two neighbouring half tables
+static UInt16 morph_pos; // Position in h_half_all, Q8
+static Int16 morph_dir; // Direction of the sweep
+
+/* ---- Chorus ---- */
+static Int16 chorus_sin[(1 << CHORUS_LFO_BITS) + 1]; // One LFO cycle in Q15, first entry repeated
+static UInt32 chorus_phase; // LFO phase at the end of the last frame, Q32 of a cycle
+static Int32 chorus_d[CHORUS_VOICES]; // Delay of each voice, Q16 samples
+#if CHORUS_ALLPASS
+static Int16 chorus_eta[257]; // Allpass coefficient for delays of 0.5 to 1.5 samples, Q15
+static Int32 chorus_ap[CHORUS_VOICES]; // Last output of each voice's allpass
+#endif
+
+// LFO phase step per sample for a rate in Hz, Q32 of a cycle at 48 kHz
+#define CHORUS_STEP(hz) ((UInt32)((hz) * (4294967296.0 / 48000.0)))
+
+/* ======== chorus_lfo ======== */
+// Returns the chorus delay in Q16 samples at an LFO phase (Q32 of a
+// cycle), interpolating linearly between the entries of chorus_sin.
+//
+static inline Int32 chorus_lfo(UInt32 phase)
+{
+    UInt16 i = (UInt16)(phase >> (32 - CHORUS_LFO_BITS));
+    Int32 frac = (Int32)(phase >> (16 - CHORUS_LFO_BITS)) & 0xFFFF;
+    Int32 s = chorus_sin[i] + ((((Int32)chorus_sin[i + 1] - chorus_sin[i]) * frac) >> 16);
+
+    // s is Q15, so s*2*depth is the Q16 offset from the centre delay
+    return ((Int32)CHORUS_DELAY << 16) + s * (2 * CHORUS_DEPTH);
+}
+
+/* ---- FDN reverb ---- */
+// The lines are carved one after the other from reverb_mem
+#pragma DATA_SECTION(reverb_mem, "reverb_mem")
+static Int16 reverb_mem[REVERB_MEM_LEN];
+static const UInt16 reverb_len[REVERB_LINES] = REVERB_LENGTHS;
+static Int16 *reverb_line[REVERB_LINES]; // Start of each line in reverb_mem
+static UInt16 reverb_i[REVERB_LINES]; // Oldest sample of each line, overwritten next
+static Int32 reverb_lp[REVERB_LINES]; // Lowpass state of each line
+// Q15 loop gain of each line over sqrt(lines) at every 1 << REVERB_GAIN_BITS
+// knob steps, filled by audio_init() and interpolated by audio_updateParams()
+static UInt16 reverb_gains[REVERB_LINES][(4096 >> REVERB_GAIN_BITS) + 1];
+
+/* ---- State-variable wah ---- */
+static Float svf_ic1, svf_ic2; // Integrator states of the SVF
+static UInt32 svf_pos; // Sweep position in wah_svf_g, Q24
+static Int16 svf_dir; // Direction of the sweep
+
+/* ---- Effect parameters ---- */
+// audio_updateParams() fills the set audio_param does not point to and
+// then swaps the pointer, so a kernel preempted by effectIn1_hwi never
+// sees a half-written set.
+static audio_params audio_paramSets[2];
+const audio_params * volatile audio_param = &audio_paramSets[0];
+
+// Address of a buffer or register as seen by the DMA (host builds remap it)
+#ifndef DMA_ADDR
+#define DMA_ADDR(p) ((Uint32)(p))
+#endif
+
+
+/* ======== audio_init ======== */
+// Clears the sample history and frames and selects the passthrough effect.
+// Called from main() before BIOS_start().
+//
+void audio_init(void)
+{
+    UInt16 i, j;
+
+    delay_init(&audio_line, sample_buffer, buffer_length);
+
+    delay_segReset();
+    conv_init(&cab_conv, delay_segAlloc(CAB_SEGS), CAB_SEGS, cab_ir, CAB_IR_LEN);
+    delay_longInit(&echo_line, delay_segAlloc(ECHO_SEGS), ECHO_SEGS);
+    echo_lp = 0;
+    audio_dc = 0;
+    for(i = 0; i < AUDIO_FRAME_LEN; i++){
+        audio_inFrame[0][i] = audio_inFrame[1][i] = 0;
+        audio_outFrame[0][i] = audio_outFrame[1][i] = 0;
+    }
+    frame_i = 0;
+    frame_half = 0;
+    frame_ready = 0;
+    dma_primed = FALSE;
+    audio_stat.write = audio_stat.read = 0;
+    audio_stat.dropped = audio_stat.late = audio_stat.max_backlog = 0;
+    audio_lat.state = AUDIO_LAT_IDLE;
+    audio_lat.peak = 0;
+    audio_lat.at = audio_lat.peak_at = audio_lat.samples = audio_lat.us = 0;
+    audio_lat.runs = 0;
+
+    wahFlag = FALSE;
+    wahTickFlag = FALSE;
+    wahIndex = 0;
+    wahDirection = 1;
+
+    for(i = 0; i < N/2; i++) h_morph[i] = h_half_all[0][i];
+    morph_pos = 0;
+    morph_dir = 1;
+
+    svf_ic1 = svf_ic2 = 0;
+    svf_pos = 0;
+    svf_dir = 1;
+
+    for(i = 0; i <= (1 << CHORUS_LFO_BITS); i++){
+        chorus_sin[i] = (Int16)(32767.0f * sinf(6.2831853f * i / (1 << CHORUS_LFO_BITS)));
+    }
+    chorus_phase = 0;
+    for(i = 0; i < CHORUS_VOICES; i++) chorus_d[i] = chorus_lfo(i * (0xFFFFFFFFUL / CHORUS_VOICES));
+#if CHORUS_ALLPASS
+    // eta = (1 - f)/(1 + f) for a fractional delay f = 0.5 + i/256
+    for(i = 0; i <= 256; i++){
+        Float f = 0.5f + i / 256.0f;
+        chorus_eta[i] = (Int16)(32767.0f * (1 - f) / (1 + f));
+    }
+    for(i = 0; i < CHORUS_VOICES; i++) chorus_ap[i] = 0;
+#endif
+
+    for(i = 0, j = 0; i < REVERB_LINES; j += reverb_len[i++]){
+        reverb_line[i] = &reverb_mem[j];
+        reverb_i[i] = 0;
+        reverb_lp[i] = 0;
+    }
+    for(i = 0; i < REVERB_MEM_LEN; i++) reverb_mem[i] = 0;
+
+    // Each line loses 60 dB per RT60 seconds; the Hadamard matrix
+    // is only orthogonal after the 1/sqrt(lines) folded in here
+    for(i = 0; i <= (4096 >> REVERB_GAIN_BITS); i++){
+        UInt16 knob = (i << REVERB_GAIN_BITS) > 4095 ? 4095 : i << REVERB_GAIN_BITS;
+        Float rt60 = REVERB_MIN_RT60 + (REVERB_MAX_RT60 - REVERB_MIN_RT60) * knob / 4095.0f;
+
+        for(j = 0; j < REVERB_LINES; j++){
+            reverb_gains[j][i] = (UInt16)(32767.0f / sqrtf(REVERB_LINES) *
+                                 powf(10.0f, -3.0f * reverb_len[j] / (rt60 * 48000.0f)));
+        }
+    }
+
+    audio_updateParams(effectKnob_result);
+
+    // Initialize WAHWAH bandpass window array
+    h_half = h_half_arrays[0];
+    h_q15 = h_q15_arrays[0];
+
+    // Empty the effect chain (passthrough)
+    chain_init();
+    audio_in = &audio_line;
+}
+
+/* ======== audio_dmaChannel ======== */
+// Configures a DMA channel to move one word per ADCD INT1 trigger and
+// one frame per transfer, in continuous mode. The channel reloads its
+// addresses from the shadow registers at the start of every transfer.
+//
+static void audio_dmaChannel(volatile struct CH_REGS *ch, UInt16 chNum,
+                             volatile UInt16 *src, Int16 srcStep,
+                             volatile UInt16 *dst, Int16 dstStep, Bool intEnable)
+{
+    ch->MODE.all = 0;
+    ch->MODE.bit.PERINTSEL = chNum; // Trigger is selected in DMACHSRCSELx
+    ch->BURST_SIZE.all = 0; // 1 word per burst
+    ch->SRC_BURST_STEP = 0;
+    ch->DST_BURST_STEP = 0;
+    ch->TRANSFER_SIZE = AUDIO_FRAME_LEN - 1; // 1 frame per transfer
+    ch->SRC_TRANSFER_STEP = srcStep;
+    ch->DST_TRANSFER_STEP = dstStep;
+    ch->SRC_WRAP_SIZE = 0xFFFF; // No wrapping
+    ch->DST_WRAP_SIZE = 0xFFFF;
+
+    ch->SRC_BEG_ADDR_SHADOW = DMA_ADDR(src);
+    ch->SRC_ADDR_SHADOW = DMA_ADDR(src);
+    ch->DST_BEG_ADDR_SHADOW = DMA_ADDR(dst);
+    ch->DST_ADDR_SHADOW = DMA_ADDR(dst);
+
+    ch->MODE.bit.PERINTE = 1; // Peripheral trigger enable
+    ch->MODE.bit.CONTINUOUS = 1; // Re-arm after every transfer
+    ch->MODE.bit.CHINTMODE = 0; // Interrupt at the start of a transfer
+    ch->MODE.bit.CHINTE = intEnable;
+
+    ch->CONTROL.bit.PERINTCLR = 1;
+    ch->CONTROL.bit.ERRCLR = 1;
+}
+
+/* ======== audio_dmaInit ======== */
+// Sets up DMA CH1 to copy ADCD result 0 into audio_inFrame and CH2 to
+// copy audio_outFrame into the DAC, both triggered by ADCD INT1.
+// Called from main() when AUDIO_USE_DMA is set.
+//
+void audio_dmaInit(void)
+{
+    dma_primed = FALSE;
+    frame_half = 1; // First interrupt "completes" half 1, starting half 0
+
+EALLOW;
+    CpuSysRegs.PCLKCR0.bit.DMA = 1; // Enable DMA clock
+    CpuSysRegs.SECMSEL.bit.PF1SEL = 1; // DMA owns peripheral frame 1 (ADC results, DAC)
+
+    DmaRegs.DMACTRL.bit.HARDRESET = 1;
+#ifdef __TMS320C28XX__
+    __asm(" NOP"); // One cycle before the DMA registers can be written
+#endif
+    DmaRegs.DEBUGCTRL.bit.FREE = 1; // Keep running when halted by the debugger
+
+    // ADCINT1 keeps triggering without the CPU clearing its flag
+    AdcdRegs.ADCINTSEL1N2.bit.INT1CONT = 1;
+
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = DMA_ADCDINT1;
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2 = DMA_ADCDINT1;
+
+    audio_dmaChannel(&DmaRegs.CH1, 1, &AdcdResultRegs.ADCRESULT0, 0,
+                     audio_inFrame[0], 1, TRUE);
+    audio_dmaChannel(&DmaRegs.CH2, 2, audio_outFrame[0], 1,
+                     &DacbRegs.DACVALS.all, 0, FALSE);
+
+    DmaRegs.CH1.CONTROL.bit.RUN = 1;
+    DmaRegs.CH2.CONTROL.bit.RUN = 1;
+EDIS;
+}
+
+/* ======== audio_updateParams ======== */
+// Derives every effect's parameters from the knob position (0 to 4095)
+// and publishes them to the kernels. Called by effectIn1_hwi each time
+// the knob is sampled.
+//
+void audio_updateParams(UInt16 knob)
+{
+    audio_params *p = (audio_param == &audio_paramSets[0]) ? &audio_paramSets[1] : &audio_paramSets[0];
+
+    // 1 to 12 bits of resolution based on effect knob position
+    UInt16 bits = (UInt16)(((UInt32)11 * knob) >> 12) + 1;
+    UInt16 gi = knob >> REVERB_GAIN_BITS, gf = knob & ((1 << REVERB_GAIN_BITS) - 1);
+    UInt32 m;
+    UInt16 j;
+
+    // Calculate number of bits to shift by based on UInt16 resolution from ADC
+    p->crush_shift = N_bits - bits;
+    if(p->crush_shift >= N_bits) p->crush_shift = 0;
+
+    // Delay between echoes is ~100ms to ECHO_MAX_DELAY (0.6s at full rate)
+    // The extra taps split the delay evenly
+    m = ECHO_MIN_DELAY + (((UInt32)knob * ECHO_DELAY_STEP) >> 8);
+    if(m > ECHO_MAX_DELAY) m = ECHO_MAX_DELAY;
+    for(j = 0; j < ECHO_TAPS; j++) p->echo_delay[j] = m * (j + 1) / ECHO_TAPS;
+    p->echo_gain = ECHO_FEEDBACK;
+    p->echo_damp = ECHO_DAMP;
+
+    // LFO rate of 0.1 Hz to 5 Hz, wet mix of 0.3 shared by the voices
+    p->chorus_rate = CHORUS_STEP(CHORUS_MIN_RATE) + (UInt32)knob *
+        ((CHORUS_STEP(CHORUS_MAX_RATE) - CHORUS_STEP(CHORUS_MIN_RATE)) / 4095);
+    p->chorus_gain = 9830 / CHORUS_VOICES;
+
+    // Decay gains interpolated from the table built by audio_init()
+    for(j = 0; j < REVERB_LINES; j++){
+        const UInt16 *g = &reverb_gains[j][gi];
+
+        p->reverb_gain[j] = g[0] + (UInt16)((((Int32)g[1] - g[0]) * gf) >> REVERB_GAIN_BITS);
+    }
+
+    // Same sweep time as effect_wah, which moves one table per
+    // (knob>>8) + 1 ticks across NUM_BPF - 1 steps. In Q24 the slowest
+    // step loses less than 0.01 % to truncation (5 % in Q16).
+    p->wah_sweep = ((UInt32)WAH_SVF_STEPS << 24) /
+                   ((UInt32)(NUM_BPF - 1) * ((knob>>8) + 1) * AUDIO_TICK_SAMPLES);
+
+    // One table per (knob>>8) + 1 ticks, as effect_wah, but in 1/256 steps
+    p->wah_morph = 256 / ((knob>>8) + 1);
+
+    // Publish the new set
+    audio_param = p;
+}
+
+/* ======== effect_bitCrush ======== */
+// Reduces the resolution of x to the specified
+// number of bits (m).
+//
+// - MP
+//
+// N_bits is the bit resolution of the sample (16- or 12-bit)
+//
+// Parameters:
+// y - The output frame.
+// x - The frame to reduce the resolution of.
+// n - Number of samples in the frame.
+void effect_bitCrush(Int16 *y, Int16 *x, UInt16 n)
+{
+    UInt16 k;
+    UInt16 shift = audio_param->crush_shift;
+
+    // Clear the low bits to reduce bit resolution (rounds towards
+    // negative full scale, as shifting right and back would)
+    UInt16 keep = (UInt16)~((1U << shift) - 1);
+
+    for(k = 0; k < n; k++) y[k] = (Int16)((UInt16)x[k] & keep);
+}
+
+/* ======== effect_echo ======== */
+// Adds an echo effect to the sample by
+// adding an attenuated sample to the current sample
+// with m elements of delay.
+//
+// echo_line holds the dry input plus the fed-back repeats, apart from
+// the input history, so the wah and chorus windows never see the echo.
+// Each repeat passes a one-pole lowpass, so it comes back darker than
+// the last, and is saturated before it is stored, so even a feedback
+// gain close to 1 cannot wrap around. Extra taps (ECHO_TAPS) are only
+// mixed into the output.
+//
+// Parameters:
+// y - The output frame.
+// x - The frame to add delay to.
+// n - Number of samples in the frame.
+//
+// The delays (up to ECHO_MAX_DELAY samples, held in echo_line), the
+// feedback gain and the damping come from audio_param.
+//
+// - KB
+//
+void effect_echo(Int16 *y, Int16 *x, UInt16 n)
+{
+    const audio_params *p = audio_param;
+    UInt32 m = p->echo_delay[ECHO_TAPS - 1];
+    Int32 lp = echo_lp;
+    UInt16 k;
+
+    for(k = 0; k < n; k++){
+        Int32 v = delay_longRead(&echo_line, m);
+        Int32 w, out;
+
+        lp += ((v - lp) * p->echo_damp) >> 15;
+        w = audio_sat(x[k] + ((lp * p->echo_gain) >> 15));
+        out = w;
+
+#if ECHO_TAPS > 1
+        {
+            UInt16 j;
+
+            for(j = 0; j < ECHO_TAPS - 1; j++){
+                v = delay_longRead(&echo_line, p->echo_delay[j]);
+                out += (v * p->echo_gain) >> 15;
+            }
+        }
+#endif
+
+        // Feed the damped echo back into the delay line
+        delay_longWrite(&echo_line, (Int16)w);
+
+        y[k] = audio_sat(out);
+    }
+
+    echo_lp = lp;
+}
+
+/* ======== wah_step ======== */
+// Moves the wah to the next bandpass table when tickFxn has set
+// wahFlag, sweeping back and forth through h_arrays.
+//
+static void wah_step(void)
+{
+    if(wahFlag == TRUE){
+        wahFlag = FALSE;
+
+        h_half = h_half_arrays[wahIndex];
+        h_q15 = h_q15_arrays[wahIndex];
+
+        // If the wah index is greater than or equal
+        // to the number of arrays
+        if(wahIndex >= NUM_BPF - 1) wahDirection = -1;
+
+        // Otherwise, if the wah index reaches zero
+        else if(wahIndex == 0) wahDirection = 1;
+
+        wahIndex += wahDirection;
+    }
+}
+
+/* ======== wah_fir ======== */
+// Folded FIR shared by effect_wah and effect_wahMorph. Filters the
+// n samples of the current frame with the half table hh.
+//
+static inline void wah_fir(Int16 *y, UInt16 n, const Float *hh)
+{
+    UInt16 k, t;
+    const Int16 *w = delay_ptr(audio_in, N - 1); // Oldest sample in the window
+
+    for(k = 0; k < n; k++){
+        const Int16 *oldest = &w[k]; // x[k - (N - 1)]
+        const Int16 *newest = &w[k + N - 1]; // x[k]
+        Float acc = 0;
+
+        // Increment through each pair of the folded dot product
+        for(t = 0; t < N/2; t++){
+            Int32 pair = (Int32)*newest-- + *oldest++;
+
+            // Sum each product
+            acc += (Float)pair * hh[t];
+        }
+
+        y[k] = audio_sat((Int32)acc);
+    }
+}
+
+/* ======== effect_wah ======== */
+// Implements an FIR bandpass filter via Hamming windowing method
+// The center frequency of the filter is changed by changing the
+// filter coefficient array at a configurable increment period.
+// The tables are linear phase (h[t] == h[N-1-t]), so the delay line
+// is folded: the two samples sharing a coefficient are added first and
+// only the N/2 unique coefficients in h_half are multiplied.
+// The N - 1 + n samples the frame needs are contiguous in audio_in,
+// so each pair is read by two pointers walking towards each other.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame (in audio_in, at audio_in->i).
+// n - Number of samples in the frame.
+//
+// - MP & KB
+//
+void effect_wah(Int16 *y, Int16 *x, UInt16 n)
+{
+    wah_step();
+    wah_fir(y, n, h_half);
+}
+
+/* ======== effect_wahMorph ======== */
+// Float wah that sweeps through all NUM_BPF_ALL tables with 256 steps
+// between neighbours. Once per tick the sweep moves on and the two
+// tables around the new position are blended into h_morph, so the
+// per-sample cost is the same as effect_wah.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame (in audio_in, at audio_in->i).
+// n - Number of samples in the frame.
+//
+void effect_wahMorph(Int16 *y, Int16 *x, UInt16 n)
+{
+    if(wahTickFlag == TRUE){
+        const UInt16 end = (NUM_BPF_ALL - 1) << 8;
+        UInt16 step = audio_param->wah_morph;
+        UInt16 i, t;
+        const Float *a, *b;
+        Float frac;
+
+        wahTickFlag = FALSE;
+
+        // Sweep back and forth between the first and last table
+        if(morph_dir > 0){
+            if(morph_pos < end - step) morph_pos += step;
+            else{
+                morph_pos = end;
+                morph_dir = -1;
+            }
+        }
+        else if(morph_pos > step) morph_pos -= step;
+        else{
+            morph_pos = 0;
+            morph_dir = 1;
+        }
+
+        // Blend the tables either side of the position
+        i = morph_pos >> 8;
+        if(i >= NUM_BPF_ALL - 1) i = NUM_BPF_ALL - 2;
+        a = h_half_all[i];
+        b = h_half_all[i + 1];
+        frac = (Float)(morph_pos - (i << 8)) * (1.0f/256.0f);
+
+        for(t = 0; t < N/2; t++) h_morph[t] = a[t] + (b[t] - a[t]) * frac;
+    }
+
+    wah_fir(y, n, h_morph);
+}
+
+/* ---- Fixed-point wah window ---- */
+// Oldest-first copy of the samples the current frame's FIR needs, in Q15.
+// Row 1 is row 0 shifted by one sample, so every dot product can start
+// on a 32-bit boundary as the C28x dual MAC (__dmac) requires.
+#define WAH_WIN_LEN (N - 1 + AUDIO_FRAME_LEN)
+#define WAH_WIN_ROW ((WAH_WIN_LEN + 1) & ~1)
+
+#pragma DATA_ALIGN(wah_win, 2)
+static Int16 wah_win[2][WAH_WIN_ROW];
+
+/* ======== effect_wahQ15 ======== */
+// Fixed-point version of effect_wah. Uses the Q15 tables generated
+// into bandpass_coeffs_gen.c, a 32-bit accumulator (two on the C28x,
+// one per half of the dual MAC) and saturates the result.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame (in audio_in, at audio_in->i).
+// n - Number of samples in the frame.
+//
+void effect_wahQ15(Int16 *y, Int16 *x, UInt16 n)
+{
+    UInt16 k, j;
+    const Int16 *src = delay_ptr(audio_in, N - 1); // Oldest sample in the window
+
+    wah_step();
+
+    // Gather the window into both rows
+    for(j = 0; j < N - 1 + n; j++){
+        Int16 s = src[j];
+
+        wah_win[0][j] = s;
+        if(j > 0) wah_win[1][j - 1] = s;
+    }
+
+    for(k = 0; k < n; k++){
+        // Output k uses window samples k to k + N - 1
+        const Int16 *w = (k & 1) ? &wah_win[1][k - 1] : &wah_win[0][k];
+        Int32 acc = 0;
+
+#ifdef __TMS320C28XX__
+        Int32 acc_odd = 0;
+        UInt16 t;
+
+        for(t = 0; t < N/2; t++){
+            __dmac(((long *)w)[t], ((long *)h_q15)[t], acc, acc_odd, 0);
+        }
+        acc += acc_odd;
+#else
+        UInt16 t;
+
+        for(t = 0; t < N; t++) acc += (Int32)w[t] * h_q15[t];
+#endif
+
+        y[k] = audio_sat(acc >> 15);
+    }
+}
+
+
+/* ======== effect_wahSvf ======== */
+// Wah built on a trapezoidal (TPT) state-variable bandpass. The center
+// frequency sweeps continuously: the sweep position advances every frame
+// and the integrator gain is interpolated from wah_svf_g, so there is
+// no table switching and no coefficient RAM. The filter coefficients are
+// derived once per frame; each sample then costs seven multiplies (two
+// of them doublings) and six adds.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame.
+// n - Number of samples in the frame.
+//
+#define WAH_SVF_K 0.4f // Damping (1/Q) of the bandpass
+
+void effect_wahSvf(Int16 *y, Int16 *x, UInt16 n)
+{
+    const UInt32 span = (UInt32)WAH_SVF_STEPS << 24;
+    UInt32 step = (UInt32)audio_param->wah_sweep * n;
+    UInt16 i, k;
+    Float g, a1, a2, a3;
+    Float ic1 = svf_ic1, ic2 = svf_ic2;
+
+    // Sweep back and forth between the ends of wah_svf_g
+    if(svf_dir > 0){
+        svf_pos += step;
+        if(svf_pos >= span){
+            svf_pos = 2*span - svf_pos;
+            svf_dir = -1;
+        }
+    }
+    else if(svf_pos > step) svf_pos -= step;
+    else{
+        svf_pos = step - svf_pos;
+        svf_dir = 1;
+    }
+
+    // Interpolate the integrator gain between the two nearest steps
+    i = (UInt16)(svf_pos >> 24);
+    if(i >= WAH_SVF_STEPS) i = WAH_SVF_STEPS - 1;
+    g = wah_svf_g[i] + (wah_svf_g[i + 1] - wah_svf_g[i]) *
+        ((Float)(svf_pos - ((UInt32)i << 24)) * (1.0f/16777216.0f));
+
+    a1 = 1.0f/(1.0f + g*(g + WAH_SVF_K));
+    a2 = g*a1;
+    a3 = g*a2;
+
+    for(k = 0; k < n; k++){
+        Float v3 = (Float)x[k] - ic2;
+        Float v1 = a1*ic1 + a2*v3; // Bandpass
+        Float v2 = ic2 + a2*ic1 + a3*v3; // Lowpass
+
+        ic1 = 2*v1 - ic1;
+        ic2 = 2*v2 - ic2;
+
+        // The bandpass peaks at 1/K, scale it back to unity
+        y[k] = audio_sat((Int32)(WAH_SVF_K*v1));
+    }
+
+    svf_ic1 = ic1;
+    svf_ic2 = ic2;
+}
+
+
+/* ======== effect_chorus ======== */
+// Modulated chorus: CHORUS_VOICES delayed copies of the input, each
+// swept around CHORUS_DELAY by the LFO, are mixed with the dry signal.
+//
+// The LFO runs at control rate: once per frame each voice looks up its
+// delay for the end of the frame in chorus_sin, and the delay moves
+// there in equal Q16 steps over the frame's samples, so knob changes
+// and the sweep itself never jump. The delayed sample between the two
+// taps around each fractional delay is read by linear interpolation, or
+// through a first-order allpass with CHORUS_ALLPASS.
+//
+// Parameters:
+// y - The output frame.
+// x - The frame to add chorus to (in audio_in, at audio_in->i).
+// n - Number of samples in the frame.
+//
+// The LFO rate and the gain of each voice come from audio_param.
+//
+// - KB
+//
+void effect_chorus(Int16 *y, Int16 *x, UInt16 n)
+{
+    const audio_params *p = audio_param;
+    UInt32 phase = chorus_phase + p->chorus_rate * n;
+    Int32 wet[AUDIO_FRAME_LEN];
+    UInt16 k, v;
+
+    if(n == 0) return;
+
+    for(k = 0; k < n; k++) wet[k] = 0;
+
+    for(v = 0; v < CHORUS_VOICES; v++){
+        Int32 d = chorus_d[v];
+        Int32 end = chorus_lfo(phase + v * (0xFFFFFFFFUL / CHORUS_VOICES));
+        Int32 step = (end - d) / (Int16)n;
+#if CHORUS_ALLPASS
+        Int32 ap = chorus_ap[v];
+#endif
+
+        for(k = 0; k < n; k++){
+            const Int16 *t;
+            Int32 a, b;
+
+            d += step;
+#if CHORUS_ALLPASS
+            // Delay m + f with f from 0.5 to 1.5, where the allpass is well behaved
+            {
+                Int32 u = d - 0x8000;
+
+                t = delay_ptr(audio_in, (UInt16)((Int16)(u >> 16) + 1 - k));
+                a = t[1]; // x[n - m]
+                b = t[0]; // x[n - m - 1]
+                ap = b + ((chorus_eta[(UInt16)u >> 8] * (a - ap)) >> 15);
+                wet[k] += ap;
+            }
+#else
+            t = delay_ptr(audio_in, (UInt16)((Int16)(d >> 16) + 1 - k));
+            a = t[1]; // x[n - m]
+            b = t[0]; // x[n - m - 1]
+            wet[k] += a + (((b - a) * (Int32)((UInt16)d >> 1)) >> 15);
+#endif
+        }
+
+        chorus_d[v] = end;
+#if CHORUS_ALLPASS
+        chorus_ap[v] = ap;
+#endif
+    }
+    chorus_phase = phase;
+
+    for(k = 0; k < n; k++){
+        y[k] = audio_sat(x[k] + ((wet[k] * p->chorus_gain) >> 15));
+    }
+}
+
+
+/* ======== effect_reverb ======== */
+// Feedback delay network reverb. Each sample the oldest sample of every
+// line is read, damped and scaled by the line's loop gain, the lines are
+// mixed by an unnormalised Hadamard matrix (log2(lines) stages of
+// butterflies, adds only) and written back with the input added. The
+// output taps the lines with alternating signs. The lines are prime
+// lengths, so their echoes never line up, and live in D01SARAM.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame.
+// n - Number of samples in the frame.
+//
+// The loop gains, which set the decay time, come from audio_param.
+//
+void effect_reverb(Int16 *y, Int16 *x, UInt16 n)
+{
+    const audio_params *p = audio_param;
+    Int32 v[REVERB_LINES];
+    UInt16 k, j, h, i;
+
+    for(k = 0; k < n; k++){
+        Int32 in = x[k];
+        Int32 out = 0;
+
+        for(j = 0; j < REVERB_LINES; j++){
+            Int32 s = reverb_line[j][reverb_i[j]];
+
+            out += (j & 1) ? -s : s;
+
+            // Rounded rather than truncated, which would pull every line
+            // towards -1. Rounding alone does not rule out small limit
+            // cycles; pedal_bench checks that the tail reaches exactly 0.
+            reverb_lp[j] += ((s - reverb_lp[j]) * REVERB_DAMP + 0x4000) >> 15;
+            v[j] = (reverb_lp[j] * p->reverb_gain[j] + 0x4000) >> 15;
+        }
+
+        for(h = 1; h < REVERB_LINES; h <<= 1){
+            for(j = 0; j < REVERB_LINES; j += 2*h){
+                for(i = j; i < j + h; i++){
+                    Int32 a = v[i], b = v[i + h];
+
+                    v[i] = a + b;
+                    v[i + h] = a - b;
+                }
+            }
+        }
+
+        // A quarter of the input goes into every line
+        for(j = 0; j < REVERB_LINES; j++){
+            reverb_line[j][reverb_i[j]] = audio_sat(v[j] + (in >> 2));
+            if(++reverb_i[j] == reverb_len[j]) reverb_i[j] = 0;
+        }
+
+        y[k] = audio_sat(in + (((out >> 1) * REVERB_MIX) >> 15));
+    }
+}
+
+
+/* ======== effect_cab ======== */
+// Cabinet simulator: convolves the input with the CAB_IR_LEN-tap
+// impulse response in cab_ir by two-level partitioned overlap-save
+// (partconv.c). Frames shorter than CONV_BLOCK come out
+// CONV_LATENCY(n) samples late.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame.
+// n - Number of samples in the frame.
+//
+void effect_cab(Int16 *y, Int16 *x, UInt16 n)
+{
+    conv_process(&cab_conv, y, x, n);
+}
+
+
+/* ======== effect_passthrough ======== */
+// This function does not apply an effect to the input sample.
+// It simply passes the current sample to the DAC output.
+//
+// Parameters:
+// y - The output frame.
+// x - The incoming frame.
+// n - Number of samples in the frame.
+//
+// - MP
+//
+void effect_passthrough(Int16 *y, Int16 *x, UInt16 n){
+    UInt16 k;
+
+    for(k = 0; k < n; k++) y[k] = x[k];
+}
+
+
+/* ======== audio_latArm ======== */
+// Starts a latency measurement with the next frame audioOut_swi takes.
+// Does nothing while one is running.
+//
+void audio_latArm(void)
+{
+    if(audio_lat.state == AUDIO_LAT_IDLE) audio_lat.state = AUDIO_LAT_ARMED;
+}
+
+#if AUDIO_LAT_ENABLE
+/* ======== audio_latInject ======== */
+// Called by audioOut_swi on a frame x in sample_buffer whose first
+// sample was stored at write count first: puts the marker in the frame
+// if armed, and mutes the input while the measurement runs.
+//
+static inline void audio_latInject(Int16 *x, UInt32 first)
+{
+    UInt16 k;
+
+    for(k = 0; k < AUDIO_FRAME_LEN; k++) x[k] = 0;
+
+    if(audio_lat.state == AUDIO_LAT_ARMED){
+        x[0] = AUDIO_LAT_MARKER;
+        audio_lat.at = audio_lat.peak_at = first;
+        audio_lat.peak = 0;
+        audio_lat.state = AUDIO_LAT_RUNNING; // Last: the Hwi searches from here
+    }
+}
+
+/* ======== audio_latScan ======== */
+// Called by the audio Hwi on n DAC codes played from write count t on:
+// keeps the one furthest from mid-scale and ends the measurement
+// AUDIO_LAT_WINDOW samples after the marker.
+//
+static inline void audio_latScan(const volatile UInt16 *out, UInt16 n, UInt32 t)
+{
+    UInt16 k;
+
+    for(k = 0; k < n; k++, t++){
+        UInt16 d = (out[k] >= 2048) ? out[k] - 2048 : 2048 - out[k];
+
+        if(d > audio_lat.peak){
+            audio_lat.peak = d;
+            audio_lat.peak_at = t;
+        }
+    }
+
+    if(t - audio_lat.at >= AUDIO_LAT_WINDOW){
+        audio_lat.samples = audio_lat.peak_at - audio_lat.at;
+        audio_lat.us = (audio_lat.samples * AUDIO_SAMPLE_CYCLES + 100) / 200;
+        trace_log(TRACE_LATENCY, (UInt16)audio_lat.samples, audio_lat.peak);
+        audio_lat.state = AUDIO_LAT_IDLE;
+        audio_lat.runs++;
+    }
+}
+#endif
+
+/* ======== audioIn_hwi ======== */
+// Hardware interrupt for the ADC measuring the
+// audio input voltage. Plays the next processed sample on the DAC
+// and stores the new sample in the input frame. Posts audioOut_swi
+// every AUDIO_FRAME_LEN samples.
+//
+// - MP
+//
+void audioIn_hwi(void)
+{
+    UInt16 half = frame_half;
+    UInt16 i = frame_i;
+
+    prof_enter(PROF_AUDIO_IN);
+
+    // Output on DAC the sample processed one frame ago
+    DacbRegs.DACVALS.bit.DACVALS = audio_outFrame[half][i];
+#if AUDIO_LAT_ENABLE
+    if(audio_lat.state == AUDIO_LAT_RUNNING) audio_latScan(&audio_outFrame[half][i], 1, audio_stat.write);
+#endif
+
+    // Store sample in the next frame slot
+    audio_inFrame[half][i] = AdcdResultRegs.ADCRESULT0; //get reading from ADC SOC0
+    audio_stat.write++;
+
+    if(++i >= AUDIO_FRAME_LEN){
+        i = 0;
+
+        // Hand the full frame to the Swi and switch halves
+        frame_ready = half;
+        frame_half = half ^ 1;
+
+        // Post Swi indicating a new frame has been captured
+        trace_log(TRACE_FRAME, half, (UInt16)audio_stat.write);
+        Swi_post(audioOut_swi_handle);
+    }
+    frame_i = i;
+
+    AdcdRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; //clear interrupt flag
+    prof_exit(PROF_AUDIO_IN);
+}
+
+/* ======== audioDma_hwi ======== */
+// Hardware interrupt from DMA CH1, raised when the channels start
+// a transfer. The half they just finished is handed to audioOut_swi
+// and the shadow addresses are pointed at it for the transfer after
+// this one, giving ping-pong buffering without per-sample interrupts.
+//
+void audioDma_hwi(void)
+{
+    UInt16 done = frame_half;
+    UInt16 next = done ^ 1;
+
+    prof_enter(PROF_AUDIO_DMA);
+
+    frame_half = next; // Half the DMA is now transferring
+
+EALLOW;
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = DMA_ADDR(audio_inFrame[done]);
+    DmaRegs.CH1.DST_ADDR_SHADOW = DMA_ADDR(audio_inFrame[done]);
+    DmaRegs.CH2.SRC_BEG_ADDR_SHADOW = DMA_ADDR(audio_outFrame[done]);
+    DmaRegs.CH2.SRC_ADDR_SHADOW = DMA_ADDR(audio_outFrame[done]);
+EDIS;
+
+    // The first interrupt only marks the start of the first frame
+    if(dma_primed){
+        audio_stat.write += AUDIO_FRAME_LEN;
+        frame_ready = done;
+        trace_log(TRACE_FRAME, done, (UInt16)audio_stat.write);
+        Swi_post(audioOut_swi_handle);
+
+#if AUDIO_LAT_ENABLE
+        // The DMA now plays the other half to the DAC, one code per sample
+        if(audio_lat.state == AUDIO_LAT_RUNNING)
+            audio_latScan(audio_outFrame[next], AUDIO_FRAME_LEN, audio_stat.write);
+#endif
+    }
+    dma_primed = TRUE;
+    prof_exit(PROF_AUDIO_DMA);
+}
+
+/* ======== effectIn1_hwi ======== */
+// Hardware interrupt for the ADC measuring the
+// effect knob output voltage. Checked 100 times per second.
+//
+// - MP
+//
+void effectIn1_hwi(void){
+    Uint16 moving_average = 0;
+
+    prof_enter(PROF_KNOB);
+
+    Uint16 i;
+
+    // Shift elements in linear buffer
+    for(i = 0; i < 9; i++){
+        effectKnob_results[i+1] = effectKnob_results[i];
+        moving_average += effectKnob_results[i+1];
+    }
+
+    // Get reading from ADC SOC0
+    effectKnob_results[0] = AdccResultRegs.ADCRESULT0;
+
+    // Compute moving average of last 10 samples to filter out
+    // any high frequency transients on effect knob ADC reading
+    moving_average = (moving_average + effectKnob_results[0])/10;
+    effectKnob_result = moving_average; // 0 to 4095
+
+    trace_log(TRACE_KNOB, moving_average, effectKnob_results[0]);
+
+    // Recompute the effect parameters for the new knob position
+    audio_updateParams(moving_average);
+
+    // Clear interrupt flag
+    AdccRegs.ADCINTFLGCLR.bit.ADCINT2 = 1;
+    prof_exit(PROF_KNOB);
+}
+
+/* ======== audioOut_swi ======== */
+// Software interrupt called when a new
+// audio frame has been captured.
+// Converts the frame to signed Q15 without its DC, appends it to the
+// sample buffer, processes it and leaves the result, back in offset
+// binary, for audioIn_hwi to play out. Counts dropped samples and late
+// runs in audio_stat, and puts in the marker of a latency measurement.
+//
+// - KB
+//
+void audioOut_swi(void){
+    prof_enter(PROF_AUDIO_OUT);
+
+    // The write index is taken before frame_ready, so the frame the Swi
+    // runs is never older than the one the counts below assume
+    UInt32 write = audio_stat.write;
+    UInt32 end = write & ~(UInt32)(AUDIO_FRAME_LEN - 1); // End of the last full frame
+    UInt32 backlog = write - audio_stat.read;
+    UInt16 half = frame_ready;
+    Int16 *x = &audio_line.buf[audio_line.i];
+    Int16 y[AUDIO_FRAME_LEN];
+    Int32 dc = audio_dc;
+    UInt16 k;
+
+    // Anything more than one frame between the last frame taken and this
+    // one was overwritten while the Swi was posted
+    trace_log(TRACE_SWI_BEGIN, (UInt16)backlog, half);
+    if(backlog > audio_stat.max_backlog) audio_stat.max_backlog = backlog;
+    if(end - audio_stat.read > AUDIO_FRAME_LEN){
+        audio_stat.dropped += end - audio_stat.read - AUDIO_FRAME_LEN;
+        trace_log(TRACE_DROP, (UInt16)(end - audio_stat.read - AUDIO_FRAME_LEN), (UInt16)backlog);
+    }
+    audio_stat.read = end;
+
+    // Flip the sign bit to centre the ADC code on zero, then subtract the
+    // running mean (leaky integrator with a 2^AUDIO_DC_BITS sample time
+    // constant). buffer_length is a multiple of AUDIO_FRAME_LEN, so the
+    // frame never wraps.
+    for(k = 0; k < AUDIO_FRAME_LEN; k++){
+        Int16 v = (Int16)(audio_inFrame[half][k] ^ 0x8000);
+
+        dc += v - (dc >> AUDIO_DC_BITS);
+        x[k] = audio_sat((Int32)v - (dc >> AUDIO_DC_BITS));
+    }
+    audio_dc = dc;
+#if AUDIO_LAT_ENABLE
+    if(audio_lat.state != AUDIO_LAT_IDLE) audio_latInject(x, end - AUDIO_FRAME_LEN);
+#endif
+    delay_mirror(&audio_line, AUDIO_FRAME_LEN);
+
+    chain_process(y, AUDIO_FRAME_LEN); // Run the frame through the effect chain
+
+    // Back to offset binary, shifted down to 12 bit DAC resolution
+    for(k = 0; k < AUDIO_FRAME_LEN; k++) audio_outFrame[half][k] = ((UInt16)y[k] ^ 0x8000) >> 4;
+
+    // Circular buffer indexing
+    delay_advance(&audio_line, AUDIO_FRAME_LEN);
+
+    // Finished after the Hwi handed over the next frame: its input may
+    // have been overwritten and this frame's output started playing
+    write = audio_stat.write;
+    if(write - end >= AUDIO_FRAME_LEN){
+        audio_stat.late++;
+        trace_log(TRACE_LATE, (UInt16)(write - end), 0);
+    }
+    trace_log(TRACE_SWI_END, (UInt16)(write - end), 0);
+    prof_exit(PROF_AUDIO_OUT);
+}
@@ -0,0 +1,343 @@
+/*
+ * EffectsPedal_audio.h
+ *
+ * Audio path of the effects pedal: the shared sample buffer, the effect
+ * kernels and the Hwi/Swi functions that move samples from the ADC to the DAC.
+ *
+ * Nothing in here depends on the BIOS configuration beyond the Swi handle,
+ * so the same source can be compiled for the F28379D or against the host
+ * stand-ins in host/ for offline rendering.
+ */
+
+#ifndef EFFECTSPEDAL_AUDIO_H_
+#define EFFECTSPEDAL_AUDIO_H_
+
+#include <xdc/std.h>
+#include <delay_line.h>
+#include <delay_mem.h>
+
+// Samples per audio frame (1, 8, 16, 32 or 64). audioIn_hwi posts audioOut_swi
+// once per frame, so larger frames spread the Swi and effect call overhead
+// over more samples. Input-to-output latency through the ping-pong frames is
+// 2*AUDIO_FRAME_LEN samples (0.33 ms to 2.7 ms at 48 kHz).
+#ifndef AUDIO_FRAME_LEN
+#define AUDIO_FRAME_LEN 16
+#endif
+
+#if AUDIO_FRAME_LEN != 1 && AUDIO_FRAME_LEN != 8 && AUDIO_FRAME_LEN != 16 && \
+    AUDIO_FRAME_LEN != 32 && AUDIO_FRAME_LEN != 64
+#error "AUDIO_FRAME_LEN must be 1, 8, 16, 32 or 64"
+#endif
+
+// audioOut_swi turns the ADC codes (offset binary) into signed Q15 and
+// removes their DC with a one-pole highpass whose corner is
+// fs / (2*pi*2^AUDIO_DC_BITS), 7.5 Hz at 10. Everything from there to
+// the DAC conversion works on Int16 samples with saturating mixes.
+#ifndef AUDIO_DC_BITS
+#define AUDIO_DC_BITS 10
+#endif
+
+#if AUDIO_DC_BITS < 4 || AUDIO_DC_BITS > 14
+#error "AUDIO_DC_BITS must be 4 to 14"
+#endif
+
+// Set to 1 to move samples between the ADC/DAC and the frames with DMA
+// channels 1 and 2 instead of audioIn_hwi. The CPU then only takes one
+// interrupt per frame (audioDma_hwi) instead of one per sample.
+#ifndef AUDIO_USE_DMA
+#define AUDIO_USE_DMA 0
+#endif
+
+#define AUDIO_ADC_INT 37 // PIE vector of ADCD INT1 (audioIn_hwi)
+#define AUDIO_DMA_INT 80 // PIE vector of DMA CH1 (audioDma_hwi)
+#define DMA_ADCDINT1 16 // DMA trigger source for ADCD INT1
+
+// Input-to-output latency measurement (audio_lat). Once armed,
+// audioOut_swi puts a marker of AUDIO_LAT_MARKER (Q15) in the first
+// sample of its next frame, straight into sample_buffer, and mutes the
+// input until the DAC writes of the following AUDIO_LAT_WINDOW samples
+// have been searched for the code furthest from mid-scale. Set
+// AUDIO_LAT_ENABLE to 0 to take the per-sample check out of the Hwi.
+#ifndef AUDIO_LAT_ENABLE
+#define AUDIO_LAT_ENABLE 1
+#endif
+#ifndef AUDIO_LAT_WINDOW
+#define AUDIO_LAT_WINDOW 4096 // ~85 ms
+#endif
+#ifndef AUDIO_LAT_MARKER
+#define AUDIO_LAT_MARKER 16384 // Half scale
+#endif
+
+#if AUDIO_LAT_WINDOW < 4 * AUDIO_FRAME_LEN
+#error "AUDIO_LAT_WINDOW must be at least 4 frames"
+#endif
+
+#define AUDIO_SAMPLE_CYCLES 4167 // adc_a1_timer period in EffectsPedal.cfg, 200 MHz cycles
+
+// Set to 1 to use the Q15 fixed-point wah (effect_wahQ15) instead of the
+// float FIR when the wah switch is selected.
+#ifndef WAH_USE_Q15
+#define WAH_USE_Q15 0
+#endif
+
+// Set to 1 to use the state-variable wah (effect_wahSvf) instead of either FIR
+#ifndef WAH_USE_SVF
+#define WAH_USE_SVF 0
+#endif
+
+// Set to 1 to use the coefficient-morphing float FIR (effect_wahMorph)
+#ifndef WAH_USE_MORPH
+#define WAH_USE_MORPH 0
+#endif
+
+#if WAH_USE_MORPH
+#define EFFECT_WAH effect_wahMorph
+#elif WAH_USE_SVF
+#define EFFECT_WAH effect_wahSvf
+#elif WAH_USE_Q15
+#define EFFECT_WAH effect_wahQ15
+#else
+#define EFFECT_WAH effect_wah
+#endif
+
+// Circular length of the sample history. A power of two, so delays are
+// masked instead of wrapped, and a multiple of every frame length so frames
+// never wrap. Long enough for the chorus; the echo has its own line.
+#define buffer_length 4096
+#define N_bits 16 // Bit resolution of input samples
+#define AUDIO_TICK_SAMPLES 480 // Samples per 10 ms tick of tickFxn
+
+// effect_chorus mixes CHORUS_VOICES copies of the input, each delayed by
+// CHORUS_DELAY +/- CHORUS_DEPTH samples as a sine LFO sweeps it. The
+// voices are spread evenly over the LFO cycle and the effect knob sets
+// its rate. A short delay and depth (e.g. 96 +/- 72) makes it a flanger.
+#ifndef CHORUS_VOICES
+#define CHORUS_VOICES 2 // 1 to 4
+#endif
+#ifndef CHORUS_DELAY
+#define CHORUS_DELAY 720 // 15 ms
+#endif
+#ifndef CHORUS_DEPTH
+#define CHORUS_DEPTH 192 // 4 ms
+#endif
+
+// Set to 1 to read the fractional delays through a first-order allpass
+// instead of linear interpolation (flat response, but a little state)
+#ifndef CHORUS_ALLPASS
+#define CHORUS_ALLPASS 0
+#endif
+
+#define CHORUS_LFO_BITS 8 // log2 of the entries in the LFO sine table
+#define CHORUS_MIN_RATE 0.1 // LFO rate in Hz at knob 0
+#define CHORUS_MAX_RATE 5.0 // and at knob 4095
+
+#if CHORUS_VOICES < 1 || CHORUS_VOICES > 4
+#error "CHORUS_VOICES must be 1 to 4"
+#endif
+
+#if CHORUS_DEPTH < 0 || CHORUS_DELAY - CHORUS_DEPTH < 1
+#error "The chorus delay must stay at least one sample"
+#endif
+
+#if CHORUS_DELAY + CHORUS_DEPTH + 2 > DELAY_MAX(buffer_length, AUDIO_FRAME_LEN)
+#error "buffer_length is too short for the longest chorus delay"
+#endif
+
+// The cab (effect_cab) keeps the spectra of its IR and of its input
+// history in the first CAB_SEGS segments of RAMGS, enough for an IR of
+// CAB_MAX_TAPS (checked in EffectsPedal_audio.c)
+#define CAB_MAX_TAPS 4096
+#define CAB_SEGS 8
+
+// Set to 1 to run every effect into the cab: gpio_effect_task puts
+// effect_cab in the last slot of the effect chain
+#ifndef AUDIO_CAB
+#define AUDIO_CAB 0
+#endif
+
+// Set to 1 to run every effect into the reverb: gpio_effect_task puts
+// effect_reverb in the slot after the switched effects (before the cab).
+// No switch is left for it, so a build with AUDIO_REVERB 1 has the reverb
+// always on and it cannot be bypassed from the pedal. The effect knob
+// sets its decay time along with the other effects' parameters.
+#ifndef AUDIO_REVERB
+#define AUDIO_REVERB 0
+#endif
+
+// The echo runs through a delay_long line over the rest of the delay_mem
+// segments: a 4096-tap cab needs 8 of RAMGS0-RAMGS14, and the echo gets
+// the 7 left (RAMGS15 is the trace ring's). How far they reach depends on
+// DELAY_LONG_DIV_BITS (delay_mem.h), which trades the echo's bandwidth
+// for delay:
+//
+//   DELAY_LONG_DIV_BITS  ECHO_MAX_DELAY  bandwidth of the repeats
+//   0 (default)          0.60 s          full (24 kHz)
+//   1                    1.19 s          flat to 8.6 kHz, 1 dB down at 10 kHz
+//   2                    2.39 s          flat to 4.3 kHz, 1 dB down at 5 kHz
+//
+// The knob steps the delay by ECHO_DELAY_STEP, in Q8 so that its top
+// reaches the end of the line.
+#define ECHO_SEGS (DELAY_NUM_SEGS - CAB_SEGS)
+#define ECHO_MIN_DELAY 4900L // ~100 ms
+#define ECHO_DELAY_STEP (((DELAY_LONG_MAX(ECHO_SEGS) - ECHO_MIN_DELAY) << 8) / 4095)
+#define ECHO_MAX_DELAY (ECHO_MIN_DELAY + ((4095 * ECHO_DELAY_STEP) >> 8)) // See the table above
+
+// Each repeat is fed back through a one-pole lowpass (ECHO_DAMP is the
+// Q15 weight of the new sample, 32767 for no damping) and the Q15 gain
+// ECHO_FEEDBACK, saturated to 16 bits. With ECHO_TAPS > 1 the output also
+// takes ECHO_TAPS - 1 earlier taps spread evenly inside the delay.
+#ifndef ECHO_FEEDBACK
+#define ECHO_FEEDBACK 6554 // 0.2
+#endif
+#ifndef ECHO_DAMP
+#define ECHO_DAMP 16384 // Corner at ~5 kHz
+#endif
+#ifndef ECHO_TAPS
+#define ECHO_TAPS 1 // 1 to 4
+#endif
+
+#if ECHO_TAPS < 1 || ECHO_TAPS > 4
+#error "ECHO_TAPS must be 1 to 4"
+#endif
+
+#if ECHO_MIN_DELAY / ECHO_TAPS < DELAY_LONG_MIN || ECHO_DELAY_STEP < 256
+#error "delay_long line does not fit the echo delay range"
+#endif
+
+// effect_reverb is a feedback delay network of REVERB_LINES (4 or 8)
+// lines of prime length, together 4096 words or less so they fit in
+// D01SARAM. The lines are mixed by a Hadamard matrix (adds only), damped
+// by a one-pole lowpass each, and the knob sets the decay time.
+#ifndef REVERB_LINES
+#define REVERB_LINES 8
+#endif
+
+#if REVERB_LINES == 8
+#define REVERB_LENGTHS { 293, 337, 409, 461, 521, 587, 673, 751 }
+#define REVERB_LINE_WORDS 4032
+#elif REVERB_LINES == 4
+#define REVERB_LENGTHS { 743, 907, 1103, 1289 }
+#define REVERB_LINE_WORDS 4042
+#else
+#error "REVERB_LINES must be 4 or 8"
+#endif
+
+#define REVERB_MEM_LEN 4096 // Words of D01SARAM
+#define REVERB_MIN_RT60 0.3f // Decay time to -60 dB in s at knob 0
+#define REVERB_MAX_RT60 4.0f // and at knob 4095
+#define REVERB_DAMP 20000 // Q15 coefficient of the lowpass in each line (~9 kHz)
+#define REVERB_MIX 16384 // Q15 gain of the wet signal
+#define REVERB_GAIN_BITS 6 // log2 of the knob steps between entries of the loop gain table
+#define REVERB_BUDGET 420 // Cycles/sample allowed (10% of 4167), checked by pedal_bench -s
+
+#if REVERB_LINE_WORDS > REVERB_MEM_LEN
+#error "The reverb lines do not fit in D01SARAM"
+#endif
+
+// Effect parameters derived from the knob at control rate (100 Hz) by
+// audio_updateParams(), so the kernels only read precomputed values.
+typedef struct {
+    UInt16 crush_shift; // effect_bitCrush: bits of resolution removed
+    UInt32 echo_delay[ECHO_TAPS]; // effect_echo: delay of each tap in samples, the last fed back
+    UInt16 echo_gain; // effect_echo: gain of the repeats in Q15
+    UInt16 echo_damp; // effect_echo: one-pole coefficient of the loop lowpass in Q15
+    UInt32 chorus_rate; // effect_chorus: LFO phase step per sample, Q32 of a cycle
+    UInt16 chorus_gain; // effect_chorus: gain of each voice in Q15
+    UInt16 reverb_gain[REVERB_LINES]; // effect_reverb: loop gain of each line over sqrt(lines), Q15
+    UInt32 wah_sweep; // effect_wahSvf: sweep step per sample, Q24 of a wah_svf_g step
+    UInt16 wah_morph; // effect_wahMorph: sweep step per tick, Q8 of a table
+} audio_params;
+
+// Effect kernel signature used by the effect chain. Processes n Q15
+// samples of x into y; x is the current frame inside audio_in, at
+// audio_in->i, and is history for later frames, so kernels only read it.
+typedef void (*audio_effect_fxn)(Int16 *y, Int16 *x, UInt16 n);
+
+// Health of the audio path, kept by the audio Hwi and audioOut_swi and
+// cleared by audio_init(). The Hwi moves the write index on per sample
+// (per frame with AUDIO_USE_DMA) and the Swi the read index per frame it
+// takes, so an overrun shows up however Swi_post coalesced. Costs one
+// increment per sample and a few instructions per frame, so it stays in
+// production builds; watch audio_stat from the CCS Expressions view or
+// ROV, or read it over a debug port.
+typedef struct {
+    UInt32 write; // Samples the Hwi has stored in the input frames
+    UInt32 read; // Samples up to the end of the frame audioOut_swi last took
+    UInt32 dropped; // Samples in frames overwritten before audioOut_swi took them
+    UInt32 late; // audioOut_swi runs that ended after the next frame was handed over
+    UInt32 max_backlog; // Most samples waiting when audioOut_swi started, normally AUDIO_FRAME_LEN
+} audio_stats;
+
+typedef enum {
+    AUDIO_LAT_IDLE, // Result of the last measurement, if any, is valid
+    AUDIO_LAT_ARMED, // Marker goes into the next frame audioOut_swi takes
+    AUDIO_LAT_RUNNING // Marker sent, DAC writes being searched
+} audio_latState;
+
+// Input-to-output latency, measured with a marker impulse. Arm it with
+// audio_latArm() or by writing AUDIO_LAT_ARMED to state from the
+// debugger, with the guitar quiet, and read samples and us once runs has
+// gone up. The count runs from the ADC sample the marker stands in for
+// to the DAC write furthest from mid-scale, so it takes in the frames,
+// the chain's group delay (27.5 samples for the 56-tap wah) and any
+// block processing; the converters themselves add under a sample.
+typedef struct {
+    UInt16 state; // audio_latState
+    UInt16 peak; // Largest distance from DAC mid-scale so far, in codes
+    UInt32 at; // audio_stat.write count of the marker's input sample
+    UInt32 peak_at; // audio_stat.write count at the DAC write of peak
+    UInt32 samples; // Last result: peak_at - at
+    UInt32 us; // The same in microseconds
+    UInt32 runs; // Measurements finished since audio_init(), bumped last
+} audio_latency;
+
+/* ======== audio_sat ======== */
+// Saturates a 32-bit filter or mix result to a Q15 sample.
+//
+static inline Int16 audio_sat(Int32 v)
+{
+    if(v > 32767) v = 32767;
+    else if(v < -32768) v = -32768;
+
+    return (Int16)v;
+}
+
+// Shared audio state
+extern volatile Bool wahFlag; // Flag used by wah effect to increment BPF frequency
+extern volatile Bool wahTickFlag; // Set every tick, used by the morphing wah
+extern volatile UInt16 wahIndex; // Index used by wah effect to increment BPF
+extern volatile Int16 wahDirection; // Direction to increment BPF frequency
+extern volatile UInt16 effectKnob_result; // Current position of Effect potentiometer
+extern volatile UInt16 effectKnob_results[10]; // Buffer used to average position of effect pot
+extern delay_line audio_line; // Input history, written only by audioOut_swi
+extern delay_line *audio_in; // History of the chain slot being run
+extern volatile UInt16 audio_inFrame[2][AUDIO_FRAME_LEN]; // Ping-pong ADC frames
+extern volatile UInt16 audio_outFrame[2][AUDIO_FRAME_LEN]; // Ping-pong DAC frames
+extern const audio_params * volatile audio_param; // Current effect parameters
+extern volatile audio_stats audio_stat; // Overrun and drop counters
+extern volatile audio_latency audio_lat; // Latency measurement
+
+void audio_init(void);
+void audio_dmaInit(void);
+void audio_updateParams(UInt16 knob);
+void audio_latArm(void);
+
+// Effect kernels
+void effect_bitCrush(Int16 *y, Int16 *x, UInt16 n);
+void effect_echo(Int16 *y, Int16 *x, UInt16 n);
+void effect_chorus(Int16 *y, Int16 *x, UInt16 n);
+void effect_wah(Int16 *y, Int16 *x, UInt16 n);
+void effect_wahQ15(Int16 *y, Int16 *x, UInt16 n);
+void effect_wahSvf(Int16 *y, Int16 *x, UInt16 n);
+void effect_wahMorph(Int16 *y, Int16 *x, UInt16 n);
+void effect_cab(Int16 *y, Int16 *x, UInt16 n);
+void effect_reverb(Int16 *y, Int16 *x, UInt16 n);
+void effect_passthrough(Int16 *y, Int16 *x, UInt16 n);
+
+// Audio threads
+void audioIn_hwi(void); // Hwi for audio input ADC
+void audioDma_hwi(void); // Hwi for audio DMA frame handoff
+void effectIn1_hwi(void); // Hwi for effect knob ADC
+void audioOut_swi(void); // Swi for DSP on a frame of samples
+
+#endif /* EFFECTSPEDAL_AUDIO_H_ */
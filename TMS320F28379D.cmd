@@ -39,8 +39,6 @@ MEMORY
 PAGE 0 :  /* Program Memory */
           /* BEGIN is used for the "boot to FLASH" bootloader mode   */
 
-    D01SARAM   : origin = 0x00B000, length = 0x001000
-
     /* Flash boot address */
     BEGIN   : origin = 0x080000, length = 0x000002
 
@@ -71,6 +69,8 @@ PAGE 1 : /* Data Memory */
 
     LS05SARAM : origin = 0x008000, length = 0x003000 /* on-chip RAM */
 
+    D01SARAM  : origin = 0x00B000, length = 0x001000 /* on-chip RAM, reverb lines */
+
     /* on-chip Global shared RAMs */
     RAMGS0  : origin = 0x00C000, length = 0x001000
     RAMGS1  : origin = 0x00D000, length = 0x001000
@@ -87,7 +87,7 @@ PAGE 1 : /* Data Memory */
     RAMGS12 : origin = 0x018000, length = 0x001000
     RAMGS13 : origin = 0x019000, length = 0x001000
     RAMGS14 : origin = 0x01A000, length = 0x001000
-    RAMGS15 : origin = 0x01B000, length = 0x001000
+    RAMGS15 : origin = 0x01B000, length = 0x001000 /* trace ring */
 
     /* Shared MessageRam */
     CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
@@ -167,10 +167,28 @@ SECTIONS
                             FLASHF | FLASHG | FLASHH | FLASHI | FLASHJ |
                             FLASHK | FLASHL | FLASHM | FLASHN PAGE = 0
 
-    Filter_RegsFile     : > RAMGS0 | RAMGS1 | RAMGS2 | RAMGS3 | RAMGS4 |
-                            RAMGS5 | RAMGS6 | RAMGS7 | RAMGS8 | RAMGS9 |
-                            RAMGS10 | RAMGS11 | RAMGS12 | RAMGS13 | RAMGS14 |
-                            RAMGS15 PAGE = 1
+    /* Segments of the delay memory (delay_mem.c), one per global shared RAM */
+    delay_gs0           : > RAMGS0  PAGE = 1
+    delay_gs1           : > RAMGS1  PAGE = 1
+    delay_gs2           : > RAMGS2  PAGE = 1
+    delay_gs3           : > RAMGS3  PAGE = 1
+    delay_gs4           : > RAMGS4  PAGE = 1
+    delay_gs5           : > RAMGS5  PAGE = 1
+    delay_gs6           : > RAMGS6  PAGE = 1
+    delay_gs7           : > RAMGS7  PAGE = 1
+    delay_gs8           : > RAMGS8  PAGE = 1
+    delay_gs9           : > RAMGS9  PAGE = 1
+    delay_gs10          : > RAMGS10 PAGE = 1
+    delay_gs11          : > RAMGS11 PAGE = 1
+    delay_gs12          : > RAMGS12 PAGE = 1
+    delay_gs13          : > RAMGS13 PAGE = 1
+    delay_gs14          : > RAMGS14 PAGE = 1
+
+    /* Trace ring (trace.c), a block of its own */
+    trace_ring          : > RAMGS15 PAGE = 1
+
+    /* Delay lines of the FDN reverb (effect_reverb) */
+    reverb_mem          : > D01SARAM PAGE = 1
 
     /* The following section definitions are required when using the IPC API Drivers */
     GROUP : > CPU1TOCPU2RAM, PAGE = 1
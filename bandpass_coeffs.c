@@ -1,217 +0,0 @@
-/*
- * bandpass_coeffs.c
- *
- *  Created on: Nov 8, 2021
- *     Authors: Kieran Bako & Matthew Peeters
- *
- *
- * This file acts as a look-up table for the bandpass FIR coefficients necessary for
- * the "WAH" effect. The intention is for the program to be able to change the center
- * frequency of the bandpass in real-time by simply changing the pointer of the array
- * the FIR calculation uses. Using this look-up table is method is intented to be
- * much less computationally intensive than generating the window coefficients in real-time
- * for the desired center frequency, then performing the dot product.
- *
- */
-
-#include "bandpass_coeffs.h"
-
-Float h_1k[N] = {
--2.8317E-03,-3.2610E-03,-3.9225E-03,-4.8428E-03,-6.0158E-03,-7.3978E-03,
--8.9055E-03,-1.0418E-02,-1.1782E-02,-1.2820E-02,-1.3344E-02,-1.3166E-02,
--1.2115E-02,-1.0053E-02,-6.8860E-03,-2.5767E-03,2.8462E-03,9.2855E-03,
-1.6575E-02,2.4486E-02,3.2736E-02,4.1004E-02,4.8947E-02,5.6219E-02,
-6.2493E-02,6.7479E-02,7.0941E-02,7.2715E-02,7.2715E-02,7.0941E-02,
-6.7479E-02,6.2493E-02,5.6219E-02,4.8947E-02,4.1004E-02,3.2736E-02,
-2.4486E-02,1.6575E-02,9.2855E-03,2.8462E-03,-2.5767E-03,-6.8860E-03,
--1.0053E-02,-1.2115E-02,-1.3166E-02,-1.3344E-02,-1.2820E-02,-1.1782E-02,
--1.0418E-02,-8.9055E-03,-7.3978E-03,-6.0158E-03,-4.8428E-03,-3.9225E-03,
--3.2610E-03,-2.8317E-03
-};
-
-Float h_1k5[N] = {
-2.0179E-03,1.6355E-03,1.1696E-03,4.7924E-04,-5.9532E-04,-2.2059E-03,
--4.4664E-03,-7.4240E-03,-1.1035E-02,-1.5151E-02,-1.9511E-02,-2.3760E-02,
--2.7464E-02,-3.0153E-02,-3.1361E-02,-3.0682E-02,-2.7814E-02,-2.2604E-02,
--1.5080E-02,-5.4670E-03,5.8186E-03,1.8187E-02,3.0918E-02,4.3214E-02,
-5.4264E-02,6.3315E-02,6.9733E-02,7.3061E-02,7.3061E-02,6.9733E-02,
-6.3315E-02,5.4264E-02,4.3214E-02,3.0918E-02,1.8187E-02,5.8186E-03,
--5.4670E-03,-1.5080E-02,-2.2604E-02,-2.7814E-02,-3.0682E-02,-3.1361E-02,
--3.0153E-02,-2.7464E-02,-2.3760E-02,-1.9511E-02,-1.5151E-02,-1.1035E-02,
--7.4240E-03,-4.4664E-03,-2.2059E-03,-5.9532E-04,4.7924E-04,1.1696E-03,
-1.6355E-03,2.0179E-03
-};
-
-Float h_2k[N] = {
-1.9216E-03,2.7316E-03,3.6942E-03,4.8107E-03,5.9759E-03,6.9672E-03,
-7.4597E-03,7.0699E-03,5.4215E-03,2.2253E-03,-2.6411E-03,-9.0671E-03,
--1.6672E-02,-2.4808E-02,-3.2603E-02,-3.9053E-02,-4.3138E-02,-4.3964E-02,
--4.0902E-02,-3.3696E-02,-2.2545E-02,-8.1158E-03,8.4960E-03,2.5870E-02,
-4.2409E-02,5.6524E-02,6.6812E-02,7.2233E-02,7.2233E-02,6.6812E-02,
-5.6524E-02,4.2409E-02,2.5870E-02,8.4960E-03,-8.1158E-03,-2.2545E-02,
--3.3696E-02,-4.0902E-02,-4.3964E-02,-4.3138E-02,-3.9053E-02,-3.2603E-02,
--2.4808E-02,-1.6672E-02,-9.0671E-03,-2.6411E-03,2.2253E-03,5.4215E-03,
-7.0699E-03,7.4597E-03,6.9672E-03,5.9759E-03,4.8107E-03,3.6942E-03,
-2.7316E-03,1.9216E-03
-};
-
-Float h_2k5[N] = {
--2.8913E-03,-2.5270E-03,-1.8954E-03,-7.9480E-04,9.8732E-04,3.5747E-03,
-6.9009E-03,1.0637E-02,1.4177E-02,1.6696E-02,1.7279E-02,1.5115E-02,
-9.7009E-03,1.0288E-03,-1.0301E-02,-2.3071E-02,-3.5564E-02,-4.5791E-02,
--5.1815E-02,-5.2092E-02,-4.5793E-02,-3.3017E-02,-1.4863E-02,6.6629E-03,
-2.8911E-02,4.8975E-02,6.4132E-02,7.2283E-02,7.2283E-02,6.4132E-02,
-4.8975E-02,2.8911E-02,6.6629E-03,-1.4863E-02,-3.3017E-02,-4.5793E-02,
--5.2092E-02,-5.1815E-02,-4.5791E-02,-3.5564E-02,-2.3071E-02,-1.0301E-02,
-1.0288E-03,9.7009E-03,1.5115E-02,1.7279E-02,1.6696E-02,1.4177E-02,
-1.0637E-02,6.9009E-03,3.5747E-03,9.8732E-04,-7.9480E-04,-1.8954E-03,
--2.5270E-03,-2.8913E-03
-};
-
-Float h_3k[N] = {
--6.1808E-04,-1.9199E-03,-3.3368E-03,-4.7764E-03,-5.9333E-03,-6.2932E-03,
--5.2430E-03,-2.2740E-03,2.7740E-03,9.5063E-03,1.6886E-02,2.3323E-02,
-2.6959E-02,2.6095E-02,1.9677E-02,7.7127E-03,-8.5194E-03,-2.6534E-02,
--4.3023E-02,-5.4486E-02,-5.7991E-02,-5.1887E-02,-3.6294E-02,-1.3237E-02,
-1.3641E-02,3.9727E-02,6.0349E-02,7.1718E-02,7.1718E-02,6.0349E-02,
-3.9727E-02,1.3641E-02,-1.3237E-02,-3.6294E-02,-5.1887E-02,-5.7991E-02,
--5.4486E-02,-4.3023E-02,-2.6534E-02,-8.5194E-03,7.7127E-03,1.9677E-02,
-2.6095E-02,2.6959E-02,2.3323E-02,1.6886E-02,9.5063E-03,2.7740E-03,
--2.2740E-03,-5.2430E-03,-6.2932E-03,-5.9333E-03,-4.7764E-03,-3.3368E-03,
--1.9199E-03,-6.1808E-04
-};
-
-Float h_3k5[N] = {
-3.1613E-03,3.1425E-03,2.5417E-03,1.1040E-03,-1.3715E-03,-4.7937E-03,
--8.5818E-03,-1.1631E-02,-1.2519E-02,-9.9504E-03,-3.3027E-03,6.8917E-03,
-1.8759E-02,2.9324E-02,3.5190E-02,3.3517E-02,2.3022E-02,4.6737E-03,
--1.8197E-02,-4.0480E-02,-5.6489E-02,-6.1470E-02,-5.3015E-02,-3.1931E-02,
--2.2840E-03,2.9463E-02,5.6014E-02,7.1096E-02,7.1096E-02,5.6014E-02,
-2.9463E-02,-2.2840E-03,-3.1931E-02,-5.3015E-02,-6.1470E-02,-5.6489E-02,
--4.0480E-02,-1.8197E-02,4.6737E-03,2.3022E-02,3.3517E-02,3.5190E-02,
-2.9324E-02,1.8759E-02,6.8917E-03,-3.3027E-03,-9.9504E-03,-1.2519E-02,
--1.1631E-02,-8.5818E-03,-4.7937E-03,-1.3715E-03,1.1040E-03,2.5417E-03,
-3.1425E-03,3.1613E-03
-};
-
-Float h_4k[N] = {
--8.2204E-04,8.9663E-04,2.8448E-03,4.7158E-03,5.8581E-03,5.3653E-03,
-2.4486E-03,-3.0244E-03,-1.0080E-02,-1.6569E-02,-1.9666E-02,-1.6857E-02,
--7.1321E-03,8.1431E-03,2.5107E-02,3.8282E-02,4.2287E-02,3.3856E-02,
-1.3426E-02,-1.4414E-02,-4.1914E-02,-6.0429E-02,-6.3260E-02,-4.8096E-02,
--1.8142E-02,1.8554E-02,5.1451E-02,7.0808E-02,7.0808E-02,5.1451E-02,
-1.8554E-02,-1.8142E-02,-4.8096E-02,-6.3260E-02,-6.0429E-02,-4.1914E-02,
--1.4414E-02,1.3426E-02,3.3856E-02,4.2287E-02,3.8282E-02,2.5107E-02,
-8.1431E-03,-7.1321E-03,-1.6857E-02,-1.9666E-02,-1.6569E-02,-1.0080E-02,
--3.0244E-03,2.4486E-03,5.3653E-03,5.8581E-03,4.7158E-03,2.8448E-03,
-8.9663E-04,-8.2204E-04
-};
-
-Float h_4k5[N] = {
--2.7866E-03,-3.4298E-03,-3.0939E-03,-1.4099E-03,1.7514E-03,5.8350E-03,
-9.3664E-03,1.0252E-02,6.6848E-03,-1.6726E-03,-1.2849E-02,-2.2695E-02,
--2.6233E-02,-1.9856E-02,-3.4623E-03,1.8586E-02,3.8409E-02,4.7403E-02,
-3.9891E-02,1.6083E-02,-1.7118E-02,-4.8110E-02,-6.4839E-02,-5.9676E-02,
--3.2871E-02,6.9901E-03,4.5921E-02,6.9786E-02,6.9786E-02,4.5921E-02,
-6.9901E-03,-3.2871E-02,-5.9676E-02,-6.4839E-02,-4.8110E-02,-1.7118E-02,
-1.6083E-02,3.9891E-02,4.7403E-02,3.8409E-02,1.8586E-02,-3.4623E-03,
--1.9856E-02,-2.6233E-02,-2.2695E-02,-1.2849E-02,-1.6726E-03,6.6848E-03,
-1.0252E-02,9.3664E-03,5.8350E-03,1.7514E-03,-1.4099E-03,-3.0939E-03,
--3.4298E-03,-2.7866E-03
-};
-
-Float h_5k[N] = {
-2.0933E-03,2.2649E-04,-2.2343E-03,-4.6212E-03,-5.7406E-03,-4.2139E-03,
-6.1852E-04,7.7016E-03,1.3975E-02,1.5379E-02,9.0012E-03,-4.6491E-03,
--2.0710E-02,-3.1383E-02,-2.9512E-02,-1.2735E-02,1.4067E-02,3.9795E-02,
-5.1742E-02,4.1856E-02,1.1560E-02,-2.7659E-02,-5.8715E-02,-6.6685E-02,
--4.6199E-02,-4.6867E-03,4.0409E-02,6.9389E-02,6.9389E-02,4.0409E-02,
--4.6867E-03,-4.6199E-02,-6.6685E-02,-5.8715E-02,-2.7659E-02,1.1560E-02,
-4.1856E-02,5.1742E-02,3.9795E-02,1.4067E-02,-1.2735E-02,-2.9512E-02,
--3.1383E-02,-2.0710E-02,-4.6491E-03,9.0012E-03,1.5379E-02,1.3975E-02,
-7.7016E-03,6.1852E-04,-4.2139E-03,-5.7406E-03,-4.6212E-03,-2.2343E-03,
-2.2649E-04,2.0933E-03
-};
-
-Float h_5k5[N] = {
-1.8432E-03,3.3614E-03,3.5351E-03,1.7134E-03,-2.1284E-03,-6.6672E-03,
--9.1797E-03,-6.7814E-03,1.3921E-03,1.2474E-02,2.0274E-02,1.8361E-02,
-4.4723E-03,-1.6553E-02,-3.3853E-02,-3.5967E-02,-1.8001E-02,1.3848E-02,
-4.3889E-02,5.4747E-02,3.7466E-02,-2.0394E-03,-4.4605E-02,-6.7442E-02,
--5.6767E-02,-1.6218E-02,3.4174E-02,6.8355E-02,6.8355E-02,3.4174E-02,
--1.6218E-02,-5.6767E-02,-6.7442E-02,-4.4605E-02,-2.0394E-03,3.7466E-02,
-5.4747E-02,4.3889E-02,1.3848E-02,-1.8001E-02,-3.5967E-02,-3.3853E-02,
--1.6553E-02,4.4723E-03,1.8361E-02,2.0274E-02,1.2474E-02,1.3921E-03,
--6.7814E-03,-9.1797E-03,-6.6672E-03,-2.1284E-03,1.7134E-03,3.5351E-03,
-3.3614E-03,1.8432E-03
-};
-
-Float h_6k[N] = {
--2.9270E-03,-1.3224E-03,1.5357E-03,4.4992E-03,5.5890E-03,2.8964E-03,
--3.6114E-03,-1.0769E-02,-1.3136E-02,-6.5479E-03,7.7716E-03,2.1970E-02,
-2.5395E-02,1.2010E-02,-1.3554E-02,-3.6524E-02,-4.0344E-02,-1.8277E-02,
-1.9801E-02,5.1324E-02,5.4626E-02,2.3881E-02,-2.5000E-02,-6.2683E-02,
--6.4597E-02,-2.7364E-02,2.7775E-02,6.7556E-02,6.7556E-02,2.7775E-02,
--2.7364E-02,-6.4597E-02,-6.2683E-02,-2.5000E-02,2.3881E-02,5.4626E-02,
-5.1324E-02,1.9801E-02,-1.8277E-02,-4.0344E-02,-3.6524E-02,-1.3554E-02,
-1.2010E-02,2.5395E-02,2.1970E-02,7.7716E-03,-6.5479E-03,-1.3136E-02,
--1.0769E-02,-3.6114E-03,2.8964E-03,5.5890E-03,4.4992E-03,1.5357E-03,
--1.3224E-03,-2.9270E-03
-};
-
-Float h_7k[N] = {
-3.1561E-03,2.2746E-03,-7.8160E-04,-4.3603E-03,-5.4165E-03,-1.4741E-03,
-6.2118E-03,1.1611E-02,7.8863E-03,-5.4908E-03,-1.9198E-02,-1.9739E-02,
--1.7947E-03,2.3556E-02,3.4679E-02,1.7456E-02,-1.9282E-02,-4.6764E-02,
--3.8837E-02,3.6273E-03,4.9080E-02,5.8993E-02,2.0964E-02,-3.7631E-02,
--6.9652E-02,-4.7068E-02,1.4136E-02,6.5471E-02,6.5471E-02,1.4136E-02,
--4.7068E-02,-6.9652E-02,-3.7631E-02,2.0964E-02,5.8993E-02,4.9080E-02,
-3.6273E-03,-3.8837E-02,-4.6764E-02,-1.9282E-02,1.7456E-02,3.4679E-02,
-2.3556E-02,-1.7947E-03,-1.9739E-02,-1.9198E-02,-5.4908E-03,7.8863E-03,
-1.1611E-02,6.2118E-03,-1.4741E-03,-5.4165E-03,-4.3603E-03,-7.8160E-04,
-2.2746E-03,3.1561E-03
-};
-
-Float h_8k[N] = {
--2.7394E-03,-2.9880E-03,4.1615E-18,4.2109E-03,5.2309E-03,-7.0416E-18,
--8.1600E-03,-1.0079E-02,1.1036E-17,1.4795E-02,1.7560E-02,-1.4525E-17,
--2.3768E-02,-2.7137E-02,1.8512E-17,3.4184E-02,3.7759E-02,-2.1507E-17,
--4.4741E-02,-4.8036E-02,3.0713E-17,5.3959E-02,5.6488E-02,-2.2892E-17,
--6.0458E-02,-6.1830E-02,-4.8351E-17,6.3227E-02,6.3227E-02,-4.8351E-17,
--6.1830E-02,-6.0458E-02,-2.2892E-17,5.6488E-02,5.3959E-02,3.0713E-17,
--4.8036E-02,-4.4741E-02,-2.1507E-17,3.7759E-02,3.4184E-02,1.8512E-17,
--2.7137E-02,-2.3768E-02,-1.4525E-17,1.7560E-02,1.4795E-02,1.1036E-17,
--1.0079E-02,-8.1600E-03,-7.0416E-18,5.2309E-03,4.2109E-03,4.1615E-18,
--2.9880E-03,-2.7394E-03
-};
-
-Float h_9k[N] = {
-1.7601E-03,3.3892E-03,7.8290E-04,-4.0491E-03,-5.0299E-03,1.4766E-03,
-9.2555E-03,6.4756E-03,-7.8994E-03,-1.6782E-02,-3.9618E-03,1.9772E-02,
-2.2854E-02,-6.1225E-03,-3.4737E-02,-2.1963E-02,2.4260E-02,4.6841E-02,
-1.0094E-02,-4.6190E-02,-4.9161E-02,1.2174E-02,6.4071E-02,3.7693E-02,
--3.8844E-02,-7.0131E-02,-1.4159E-02,6.0797E-02,6.0797E-02,-1.4159E-02,
--7.0131E-02,-3.8844E-02,3.7693E-02,6.4071E-02,1.2174E-02,-4.9161E-02,
--4.6190E-02,1.0094E-02,4.6841E-02,2.4260E-02,-2.1963E-02,-3.4737E-02,
--6.1225E-03,2.2854E-02,1.9772E-02,-3.9618E-03,-1.6782E-02,-7.8994E-03,
-6.4756E-03,9.2555E-03,1.4766E-03,-5.0299E-03,-4.0491E-03,7.8290E-04,
-3.3892E-03,1.7601E-03
-};
-
-Float h_10k[N] = {
--4.1409E-04,-3.4307E-03,-1.5378E-03,3.8688E-03,4.8059E-03,-2.9004E-03,
--9.3691E-03,-1.5235E-03,1.3154E-02,1.0431E-02,-1.2380E-02,-2.2000E-02,
-3.5927E-03,3.1158E-02,1.3572E-02,-3.1407E-02,-3.4692E-02,1.8302E-02,
-5.1371E-02,7.2611E-03,-5.4701E-02,-3.8041E-02,3.9823E-02,6.2768E-02,
--9.1388E-03,-7.0991E-02,-2.7813E-02,5.8091E-02,5.8091E-02,-2.7813E-02,
--7.0991E-02,-9.1388E-03,6.2768E-02,3.9823E-02,-3.8041E-02,-5.4701E-02,
-7.2611E-03,5.1371E-02,1.8302E-02,-3.4692E-02,-3.1407E-02,1.3572E-02,
-3.1158E-02,3.5927E-03,-2.2000E-02,-1.2380E-02,1.0431E-02,1.3154E-02,
--1.5235E-03,-9.3691E-03,-2.9004E-03,4.8059E-03,3.8688E-03,-1.5378E-03,
--3.4307E-03,-4.1409E-04
-};
-
-Float *h;
-Float *h_arrays[] = {h_1k, h_1k5, h_2k, h_2k5, h_3k, h_3k5, h_4k, h_4k5, h_5k, h_5k5, h_6k};
-
-
@@ -10,43 +10,33 @@
  * the FIR calculation uses. Using this look-up table is method is intented to be
  * much less computationally intensive than generating the window coefficients in real-time
  * for the desired center frequency, then performing the dot product.
+ *
+ * The tables, their tap count (N) and how many there are (NUM_BPF, NUM_BPF_ALL)
+ * are generated into bandpass_coeffs_gen.h/.c by host/gen_coeffs ('make coeffs').
  */
 
 #ifndef BANDPASS_COEFFS_H_
 #define BANDPASS_COEFFS_H_
 
 #include <xdc/std.h>
-
-// Define the window size used for each array
-#define N 56
-
-// Define the number of BPF arrays available
-#define NUM_BPF 11
-
-// Instantiate FIR coefficient arrays, each with
-// a different bandpass center frequency
-extern Float h_1k[];
-extern Float h_1k5[];
-extern Float h_2k[];
-extern Float h_2k5[];
-extern Float h_3k[];
-extern Float h_3k5[];
-extern Float h_4k[];
-extern Float h_4k5[];
-extern Float h_5k[];
-extern Float h_5k5[];
-extern Float h_6k[];
-extern Float h_7k[];
-extern Float h_8k[];
-extern Float h_9k[];
-extern Float h_10k[];
-
-// Instantiate pointer used to point to the
-// current FIR array
-extern Float *h;
+#include "bandpass_coeffs_gen.h"
 
 // Instantiate array of pointers to allow for
 // easy addressing of each array
-extern Float *h_arrays[];
+extern const Float *h_arrays[];
+
+// First N/2 coefficients of each array in h_arrays, for the folded FIR
+extern const Float *h_half;
+extern const Float *h_half_arrays[];
+
+// Half tables of all NUM_BPF_ALL arrays in order of center frequency
+extern const Float *h_half_all[];
+
+// Q15 versions of the arrays in h_arrays, stored time-reversed
+extern const Int16 *h_q15;
+extern const Int16 *h_q15_arrays[];
+
+// Integrator gain g = tan(pi*fc/fs) of the state-variable wah at each step
+extern const Float wah_svf_g[WAH_SVF_STEPS + 1];
 
 #endif /* BANDPASS_COEFFS_H_ */
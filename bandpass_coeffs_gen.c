@@ -0,0 +1,511 @@
+/*
+ * bandpass_coeffs_gen.c
+ *
+ * GENERATED by host/gen_coeffs - do not edit.
+ *
+ * h_x: Hamming-windowed bandpass around x Hz, unity gain at x Hz.
+ * h_half_x: first N/2 coefficients of each symmetric table, for the
+ * folded FIR in effect_wah.
+ * h_q15_x: Q15 tables for effect_wahQ15, stored time-reversed
+ * (h_q15_x[n] = h_x[N-1-n]) and 32-bit aligned for the C28x dual MAC.
+ * h_half_all: every half table, for effect_wahMorph.
+ * wah_svf_g: SVF integrator gains for effect_wahSvf.
+ */
+
+#include "bandpass_coeffs.h"
+
+const Float h_1k[N] = {
+-2.8317E-03,-3.2610E-03,-3.9225E-03,-4.8428E-03,-6.0158E-03,-7.3978E-03,
+-8.9055E-03,-1.0418E-02,-1.1782E-02,-1.2820E-02,-1.3344E-02,-1.3166E-02,
+-1.2115E-02,-1.0053E-02,-6.8860E-03,-2.5767E-03,2.8462E-03,9.2855E-03,
+1.6575E-02,2.4486E-02,3.2736E-02,4.1004E-02,4.8947E-02,5.6219E-02,
+6.2493E-02,6.7479E-02,7.0941E-02,7.2715E-02,7.2715E-02,7.0941E-02,
+6.7479E-02,6.2493E-02,5.6219E-02,4.8947E-02,4.1004E-02,3.2736E-02,
+2.4486E-02,1.6575E-02,9.2855E-03,2.8462E-03,-2.5767E-03,-6.8860E-03,
+-1.0053E-02,-1.2115E-02,-1.3166E-02,-1.3344E-02,-1.2820E-02,-1.1782E-02,
+-1.0418E-02,-8.9055E-03,-7.3978E-03,-6.0158E-03,-4.8428E-03,-3.9225E-03,
+-3.2610E-03,-2.8317E-03
+};
+
+const Float h_1k5[N] = {
+2.0179E-03,1.6355E-03,1.1696E-03,4.7924E-04,-5.9532E-04,-2.2059E-03,
+-4.4664E-03,-7.4240E-03,-1.1035E-02,-1.5151E-02,-1.9511E-02,-2.3760E-02,
+-2.7464E-02,-3.0153E-02,-3.1361E-02,-3.0682E-02,-2.7814E-02,-2.2604E-02,
+-1.5080E-02,-5.4670E-03,5.8186E-03,1.8187E-02,3.0918E-02,4.3214E-02,
+5.4264E-02,6.3315E-02,6.9733E-02,7.3061E-02,7.3061E-02,6.9733E-02,
+6.3315E-02,5.4264E-02,4.3214E-02,3.0918E-02,1.8187E-02,5.8186E-03,
+-5.4670E-03,-1.5080E-02,-2.2604E-02,-2.7814E-02,-3.0682E-02,-3.1361E-02,
+-3.0153E-02,-2.7464E-02,-2.3760E-02,-1.9511E-02,-1.5151E-02,-1.1035E-02,
+-7.4240E-03,-4.4664E-03,-2.2059E-03,-5.9532E-04,4.7924E-04,1.1696E-03,
+1.6355E-03,2.0179E-03
+};
+
+const Float h_2k[N] = {
+1.9216E-03,2.7316E-03,3.6942E-03,4.8107E-03,5.9759E-03,6.9672E-03,
+7.4597E-03,7.0699E-03,5.4215E-03,2.2253E-03,-2.6411E-03,-9.0671E-03,
+-1.6672E-02,-2.4808E-02,-3.2603E-02,-3.9053E-02,-4.3138E-02,-4.3964E-02,
+-4.0902E-02,-3.3696E-02,-2.2545E-02,-8.1158E-03,8.4960E-03,2.5870E-02,
+4.2409E-02,5.6524E-02,6.6812E-02,7.2233E-02,7.2233E-02,6.6812E-02,
+5.6524E-02,4.2409E-02,2.5870E-02,8.4960E-03,-8.1158E-03,-2.2545E-02,
+-3.3696E-02,-4.0902E-02,-4.3964E-02,-4.3138E-02,-3.9053E-02,-3.2603E-02,
+-2.4808E-02,-1.6672E-02,-9.0671E-03,-2.6411E-03,2.2253E-03,5.4215E-03,
+7.0699E-03,7.4597E-03,6.9672E-03,5.9759E-03,4.8107E-03,3.6942E-03,
+2.7316E-03,1.9216E-03
+};
+
+const Float h_2k5[N] = {
+-2.8913E-03,-2.5270E-03,-1.8954E-03,-7.9480E-04,9.8732E-04,3.5747E-03,
+6.9009E-03,1.0637E-02,1.4177E-02,1.6696E-02,1.7279E-02,1.5115E-02,
+9.7009E-03,1.0288E-03,-1.0301E-02,-2.3071E-02,-3.5564E-02,-4.5791E-02,
+-5.1815E-02,-5.2092E-02,-4.5793E-02,-3.3017E-02,-1.4863E-02,6.6629E-03,
+2.8911E-02,4.8975E-02,6.4132E-02,7.2283E-02,7.2283E-02,6.4132E-02,
+4.8975E-02,2.8911E-02,6.6629E-03,-1.4863E-02,-3.3017E-02,-4.5793E-02,
+-5.2092E-02,-5.1815E-02,-4.5791E-02,-3.5564E-02,-2.3071E-02,-1.0301E-02,
+1.0288E-03,9.7009E-03,1.5115E-02,1.7279E-02,1.6696E-02,1.4177E-02,
+1.0637E-02,6.9009E-03,3.5747E-03,9.8732E-04,-7.9480E-04,-1.8954E-03,
+-2.5270E-03,-2.8913E-03
+};
+
+const Float h_3k[N] = {
+-6.1808E-04,-1.9199E-03,-3.3368E-03,-4.7764E-03,-5.9333E-03,-6.2932E-03,
+-5.2430E-03,-2.2740E-03,2.7740E-03,9.5063E-03,1.6886E-02,2.3323E-02,
+2.6959E-02,2.6095E-02,1.9677E-02,7.7127E-03,-8.5194E-03,-2.6534E-02,
+-4.3023E-02,-5.4486E-02,-5.7991E-02,-5.1887E-02,-3.6294E-02,-1.3237E-02,
+1.3641E-02,3.9727E-02,6.0349E-02,7.1718E-02,7.1718E-02,6.0349E-02,
+3.9727E-02,1.3641E-02,-1.3237E-02,-3.6294E-02,-5.1887E-02,-5.7991E-02,
+-5.4486E-02,-4.3023E-02,-2.6534E-02,-8.5194E-03,7.7127E-03,1.9677E-02,
+2.6095E-02,2.6959E-02,2.3323E-02,1.6886E-02,9.5063E-03,2.7740E-03,
+-2.2740E-03,-5.2430E-03,-6.2932E-03,-5.9333E-03,-4.7764E-03,-3.3368E-03,
+-1.9199E-03,-6.1808E-04
+};
+
+const Float h_3k5[N] = {
+3.1613E-03,3.1425E-03,2.5417E-03,1.1040E-03,-1.3715E-03,-4.7937E-03,
+-8.5818E-03,-1.1631E-02,-1.2519E-02,-9.9504E-03,-3.3027E-03,6.8917E-03,
+1.8759E-02,2.9324E-02,3.5190E-02,3.3517E-02,2.3022E-02,4.6737E-03,
+-1.8197E-02,-4.0480E-02,-5.6489E-02,-6.1470E-02,-5.3015E-02,-3.1931E-02,
+-2.2840E-03,2.9463E-02,5.6014E-02,7.1096E-02,7.1096E-02,5.6014E-02,
+2.9463E-02,-2.2840E-03,-3.1931E-02,-5.3015E-02,-6.1470E-02,-5.6489E-02,
+-4.0480E-02,-1.8197E-02,4.6737E-03,2.3022E-02,3.3517E-02,3.5190E-02,
+2.9324E-02,1.8759E-02,6.8917E-03,-3.3027E-03,-9.9504E-03,-1.2519E-02,
+-1.1631E-02,-8.5818E-03,-4.7937E-03,-1.3715E-03,1.1040E-03,2.5417E-03,
+3.1425E-03,3.1613E-03
+};
+
+const Float h_4k[N] = {
+-8.2204E-04,8.9663E-04,2.8448E-03,4.7158E-03,5.8581E-03,5.3653E-03,
+2.4486E-03,-3.0244E-03,-1.0080E-02,-1.6569E-02,-1.9666E-02,-1.6857E-02,
+-7.1321E-03,8.1431E-03,2.5107E-02,3.8282E-02,4.2287E-02,3.3856E-02,
+1.3426E-02,-1.4414E-02,-4.1914E-02,-6.0429E-02,-6.3260E-02,-4.8096E-02,
+-1.8142E-02,1.8554E-02,5.1451E-02,7.0808E-02,7.0808E-02,5.1451E-02,
+1.8554E-02,-1.8142E-02,-4.8096E-02,-6.3260E-02,-6.0429E-02,-4.1914E-02,
+-1.4414E-02,1.3426E-02,3.3856E-02,4.2287E-02,3.8282E-02,2.5107E-02,
+8.1431E-03,-7.1321E-03,-1.6857E-02,-1.9666E-02,-1.6569E-02,-1.0080E-02,
+-3.0244E-03,2.4486E-03,5.3653E-03,5.8581E-03,4.7158E-03,2.8448E-03,
+8.9663E-04,-8.2204E-04
+};
+
+const Float h_4k5[N] = {
+-2.7866E-03,-3.4298E-03,-3.0939E-03,-1.4099E-03,1.7514E-03,5.8350E-03,
+9.3664E-03,1.0252E-02,6.6848E-03,-1.6726E-03,-1.2849E-02,-2.2695E-02,
+-2.6233E-02,-1.9856E-02,-3.4623E-03,1.8586E-02,3.8409E-02,4.7403E-02,
+3.9891E-02,1.6083E-02,-1.7118E-02,-4.8110E-02,-6.4839E-02,-5.9676E-02,
+-3.2871E-02,6.9901E-03,4.5921E-02,6.9786E-02,6.9786E-02,4.5921E-02,
+6.9901E-03,-3.2871E-02,-5.9676E-02,-6.4839E-02,-4.8110E-02,-1.7118E-02,
+1.6083E-02,3.9891E-02,4.7403E-02,3.8409E-02,1.8586E-02,-3.4623E-03,
+-1.9856E-02,-2.6233E-02,-2.2695E-02,-1.2849E-02,-1.6726E-03,6.6848E-03,
+1.0252E-02,9.3664E-03,5.8350E-03,1.7514E-03,-1.4099E-03,-3.0939E-03,
+-3.4298E-03,-2.7866E-03
+};
+
+const Float h_5k[N] = {
+2.0933E-03,2.2649E-04,-2.2343E-03,-4.6212E-03,-5.7406E-03,-4.2139E-03,
+6.1852E-04,7.7016E-03,1.3975E-02,1.5379E-02,9.0012E-03,-4.6491E-03,
+-2.0710E-02,-3.1383E-02,-2.9512E-02,-1.2735E-02,1.4067E-02,3.9795E-02,
+5.1742E-02,4.1856E-02,1.1560E-02,-2.7659E-02,-5.8715E-02,-6.6685E-02,
+-4.6199E-02,-4.6867E-03,4.0409E-02,6.9389E-02,6.9389E-02,4.0409E-02,
+-4.6867E-03,-4.6199E-02,-6.6685E-02,-5.8715E-02,-2.7659E-02,1.1560E-02,
+4.1856E-02,5.1742E-02,3.9795E-02,1.4067E-02,-1.2735E-02,-2.9512E-02,
+-3.1383E-02,-2.0710E-02,-4.6491E-03,9.0012E-03,1.5379E-02,1.3975E-02,
+7.7016E-03,6.1852E-04,-4.2139E-03,-5.7406E-03,-4.6212E-03,-2.2343E-03,
+2.2649E-04,2.0933E-03
+};
+
+const Float h_5k5[N] = {
+1.8432E-03,3.3614E-03,3.5351E-03,1.7134E-03,-2.1284E-03,-6.6672E-03,
+-9.1797E-03,-6.7814E-03,1.3921E-03,1.2474E-02,2.0274E-02,1.8361E-02,
+4.4723E-03,-1.6553E-02,-3.3853E-02,-3.5967E-02,-1.8001E-02,1.3848E-02,
+4.3889E-02,5.4747E-02,3.7466E-02,-2.0394E-03,-4.4605E-02,-6.7442E-02,
+-5.6767E-02,-1.6218E-02,3.4174E-02,6.8355E-02,6.8355E-02,3.4174E-02,
+-1.6218E-02,-5.6767E-02,-6.7442E-02,-4.4605E-02,-2.0394E-03,3.7466E-02,
+5.4747E-02,4.3889E-02,1.3848E-02,-1.8001E-02,-3.5967E-02,-3.3853E-02,
+-1.6553E-02,4.4723E-03,1.8361E-02,2.0274E-02,1.2474E-02,1.3921E-03,
+-6.7814E-03,-9.1797E-03,-6.6672E-03,-2.1284E-03,1.7134E-03,3.5351E-03,
+3.3614E-03,1.8432E-03
+};
+
+const Float h_6k[N] = {
+-2.9270E-03,-1.3224E-03,1.5357E-03,4.4992E-03,5.5890E-03,2.8964E-03,
+-3.6114E-03,-1.0769E-02,-1.3136E-02,-6.5479E-03,7.7716E-03,2.1970E-02,
+2.5395E-02,1.2010E-02,-1.3554E-02,-3.6524E-02,-4.0344E-02,-1.8277E-02,
+1.9801E-02,5.1324E-02,5.4626E-02,2.3881E-02,-2.5000E-02,-6.2683E-02,
+-6.4597E-02,-2.7364E-02,2.7775E-02,6.7556E-02,6.7556E-02,2.7775E-02,
+-2.7364E-02,-6.4597E-02,-6.2683E-02,-2.5000E-02,2.3881E-02,5.4626E-02,
+5.1324E-02,1.9801E-02,-1.8277E-02,-4.0344E-02,-3.6524E-02,-1.3554E-02,
+1.2010E-02,2.5395E-02,2.1970E-02,7.7716E-03,-6.5479E-03,-1.3136E-02,
+-1.0769E-02,-3.6114E-03,2.8964E-03,5.5890E-03,4.4992E-03,1.5357E-03,
+-1.3224E-03,-2.9270E-03
+};
+
+const Float h_7k[N] = {
+3.1561E-03,2.2746E-03,-7.8160E-04,-4.3603E-03,-5.4165E-03,-1.4741E-03,
+6.2118E-03,1.1611E-02,7.8863E-03,-5.4908E-03,-1.9198E-02,-1.9739E-02,
+-1.7947E-03,2.3556E-02,3.4679E-02,1.7456E-02,-1.9282E-02,-4.6764E-02,
+-3.8837E-02,3.6273E-03,4.9080E-02,5.8993E-02,2.0964E-02,-3.7631E-02,
+-6.9652E-02,-4.7068E-02,1.4136E-02,6.5471E-02,6.5471E-02,1.4136E-02,
+-4.7068E-02,-6.9652E-02,-3.7631E-02,2.0964E-02,5.8993E-02,4.9080E-02,
+3.6273E-03,-3.8837E-02,-4.6764E-02,-1.9282E-02,1.7456E-02,3.4679E-02,
+2.3556E-02,-1.7947E-03,-1.9739E-02,-1.9198E-02,-5.4908E-03,7.8863E-03,
+1.1611E-02,6.2118E-03,-1.4741E-03,-5.4165E-03,-4.3603E-03,-7.8160E-04,
+2.2746E-03,3.1561E-03
+};
+
+const Float h_8k[N] = {
+-2.7394E-03,-2.9880E-03,-2.9375E-18,4.2109E-03,5.2309E-03,-6.9252E-18,
+-8.1600E-03,-1.0079E-02,1.1036E-17,1.4795E-02,1.7560E-02,-1.5736E-17,
+-2.3768E-02,-2.7137E-02,1.8512E-17,3.4184E-02,3.7759E-02,2.5808E-17,
+-4.4741E-02,-4.8036E-02,2.0475E-17,5.3959E-02,5.6488E-02,0.0000E+00,
+-6.0458E-02,-6.1830E-02,4.8351E-17,6.3227E-02,6.3227E-02,4.8351E-17,
+-6.1830E-02,-6.0458E-02,0.0000E+00,5.6488E-02,5.3959E-02,2.0475E-17,
+-4.8036E-02,-4.4741E-02,2.5808E-17,3.7759E-02,3.4184E-02,1.8512E-17,
+-2.7137E-02,-2.3768E-02,-1.5736E-17,1.7560E-02,1.4795E-02,1.1036E-17,
+-1.0079E-02,-8.1600E-03,-6.9252E-18,5.2309E-03,4.2109E-03,-2.9375E-18,
+-2.9880E-03,-2.7394E-03
+};
+
+const Float h_9k[N] = {
+1.7601E-03,3.3892E-03,7.8290E-04,-4.0491E-03,-5.0299E-03,1.4766E-03,
+9.2555E-03,6.4756E-03,-7.8994E-03,-1.6782E-02,-3.9618E-03,1.9772E-02,
+2.2854E-02,-6.1225E-03,-3.4737E-02,-2.1963E-02,2.4260E-02,4.6841E-02,
+1.0094E-02,-4.6190E-02,-4.9161E-02,1.2174E-02,6.4071E-02,3.7693E-02,
+-3.8844E-02,-7.0131E-02,-1.4159E-02,6.0797E-02,6.0797E-02,-1.4159E-02,
+-7.0131E-02,-3.8844E-02,3.7693E-02,6.4071E-02,1.2174E-02,-4.9161E-02,
+-4.6190E-02,1.0094E-02,4.6841E-02,2.4260E-02,-2.1963E-02,-3.4737E-02,
+-6.1225E-03,2.2854E-02,1.9772E-02,-3.9618E-03,-1.6782E-02,-7.8994E-03,
+6.4756E-03,9.2555E-03,1.4766E-03,-5.0299E-03,-4.0491E-03,7.8290E-04,
+3.3892E-03,1.7601E-03
+};
+
+const Float h_10k[N] = {
+-4.1409E-04,-3.4307E-03,-1.5378E-03,3.8688E-03,4.8059E-03,-2.9004E-03,
+-9.3691E-03,-1.5235E-03,1.3154E-02,1.0431E-02,-1.2380E-02,-2.2000E-02,
+3.5927E-03,3.1158E-02,1.3572E-02,-3.1407E-02,-3.4692E-02,1.8302E-02,
+5.1371E-02,7.2611E-03,-5.4701E-02,-3.8041E-02,3.9823E-02,6.2768E-02,
+-9.1388E-03,-7.0991E-02,-2.7813E-02,5.8091E-02,5.8091E-02,-2.7813E-02,
+-7.0991E-02,-9.1388E-03,6.2768E-02,3.9823E-02,-3.8041E-02,-5.4701E-02,
+7.2611E-03,5.1371E-02,1.8302E-02,-3.4692E-02,-3.1407E-02,1.3572E-02,
+3.1158E-02,3.5927E-03,-2.2000E-02,-1.2380E-02,1.0431E-02,1.3154E-02,
+-1.5235E-03,-9.3691E-03,-2.9004E-03,4.8059E-03,3.8688E-03,-1.5378E-03,
+-3.4307E-03,-4.1409E-04
+};
+
+const Float h_half_1k[N/2] = {
+-2.8317E-03,-3.2610E-03,-3.9225E-03,-4.8428E-03,-6.0158E-03,-7.3978E-03,
+-8.9055E-03,-1.0418E-02,-1.1782E-02,-1.2820E-02,-1.3344E-02,-1.3166E-02,
+-1.2115E-02,-1.0053E-02,-6.8860E-03,-2.5767E-03,2.8462E-03,9.2855E-03,
+1.6575E-02,2.4486E-02,3.2736E-02,4.1004E-02,4.8947E-02,5.6219E-02,
+6.2493E-02,6.7479E-02,7.0941E-02,7.2715E-02
+};
+
+const Float h_half_1k5[N/2] = {
+2.0179E-03,1.6355E-03,1.1696E-03,4.7924E-04,-5.9532E-04,-2.2059E-03,
+-4.4664E-03,-7.4240E-03,-1.1035E-02,-1.5151E-02,-1.9511E-02,-2.3760E-02,
+-2.7464E-02,-3.0153E-02,-3.1361E-02,-3.0682E-02,-2.7814E-02,-2.2604E-02,
+-1.5080E-02,-5.4670E-03,5.8186E-03,1.8187E-02,3.0918E-02,4.3214E-02,
+5.4264E-02,6.3315E-02,6.9733E-02,7.3061E-02
+};
+
+const Float h_half_2k[N/2] = {
+1.9216E-03,2.7316E-03,3.6942E-03,4.8107E-03,5.9759E-03,6.9672E-03,
+7.4597E-03,7.0699E-03,5.4215E-03,2.2253E-03,-2.6411E-03,-9.0671E-03,
+-1.6672E-02,-2.4808E-02,-3.2603E-02,-3.9053E-02,-4.3138E-02,-4.3964E-02,
+-4.0902E-02,-3.3696E-02,-2.2545E-02,-8.1158E-03,8.4960E-03,2.5870E-02,
+4.2409E-02,5.6524E-02,6.6812E-02,7.2233E-02
+};
+
+const Float h_half_2k5[N/2] = {
+-2.8913E-03,-2.5270E-03,-1.8954E-03,-7.9480E-04,9.8732E-04,3.5747E-03,
+6.9009E-03,1.0637E-02,1.4177E-02,1.6696E-02,1.7279E-02,1.5115E-02,
+9.7009E-03,1.0288E-03,-1.0301E-02,-2.3071E-02,-3.5564E-02,-4.5791E-02,
+-5.1815E-02,-5.2092E-02,-4.5793E-02,-3.3017E-02,-1.4863E-02,6.6629E-03,
+2.8911E-02,4.8975E-02,6.4132E-02,7.2283E-02
+};
+
+const Float h_half_3k[N/2] = {
+-6.1808E-04,-1.9199E-03,-3.3368E-03,-4.7764E-03,-5.9333E-03,-6.2932E-03,
+-5.2430E-03,-2.2740E-03,2.7740E-03,9.5063E-03,1.6886E-02,2.3323E-02,
+2.6959E-02,2.6095E-02,1.9677E-02,7.7127E-03,-8.5194E-03,-2.6534E-02,
+-4.3023E-02,-5.4486E-02,-5.7991E-02,-5.1887E-02,-3.6294E-02,-1.3237E-02,
+1.3641E-02,3.9727E-02,6.0349E-02,7.1718E-02
+};
+
+const Float h_half_3k5[N/2] = {
+3.1613E-03,3.1425E-03,2.5417E-03,1.1040E-03,-1.3715E-03,-4.7937E-03,
+-8.5818E-03,-1.1631E-02,-1.2519E-02,-9.9504E-03,-3.3027E-03,6.8917E-03,
+1.8759E-02,2.9324E-02,3.5190E-02,3.3517E-02,2.3022E-02,4.6737E-03,
+-1.8197E-02,-4.0480E-02,-5.6489E-02,-6.1470E-02,-5.3015E-02,-3.1931E-02,
+-2.2840E-03,2.9463E-02,5.6014E-02,7.1096E-02
+};
+
+const Float h_half_4k[N/2] = {
+-8.2204E-04,8.9663E-04,2.8448E-03,4.7158E-03,5.8581E-03,5.3653E-03,
+2.4486E-03,-3.0244E-03,-1.0080E-02,-1.6569E-02,-1.9666E-02,-1.6857E-02,
+-7.1321E-03,8.1431E-03,2.5107E-02,3.8282E-02,4.2287E-02,3.3856E-02,
+1.3426E-02,-1.4414E-02,-4.1914E-02,-6.0429E-02,-6.3260E-02,-4.8096E-02,
+-1.8142E-02,1.8554E-02,5.1451E-02,7.0808E-02
+};
+
+const Float h_half_4k5[N/2] = {
+-2.7866E-03,-3.4298E-03,-3.0939E-03,-1.4099E-03,1.7514E-03,5.8350E-03,
+9.3664E-03,1.0252E-02,6.6848E-03,-1.6726E-03,-1.2849E-02,-2.2695E-02,
+-2.6233E-02,-1.9856E-02,-3.4623E-03,1.8586E-02,3.8409E-02,4.7403E-02,
+3.9891E-02,1.6083E-02,-1.7118E-02,-4.8110E-02,-6.4839E-02,-5.9676E-02,
+-3.2871E-02,6.9901E-03,4.5921E-02,6.9786E-02
+};
+
+const Float h_half_5k[N/2] = {
+2.0933E-03,2.2649E-04,-2.2343E-03,-4.6212E-03,-5.7406E-03,-4.2139E-03,
+6.1852E-04,7.7016E-03,1.3975E-02,1.5379E-02,9.0012E-03,-4.6491E-03,
+-2.0710E-02,-3.1383E-02,-2.9512E-02,-1.2735E-02,1.4067E-02,3.9795E-02,
+5.1742E-02,4.1856E-02,1.1560E-02,-2.7659E-02,-5.8715E-02,-6.6685E-02,
+-4.6199E-02,-4.6867E-03,4.0409E-02,6.9389E-02
+};
+
+const Float h_half_5k5[N/2] = {
+1.8432E-03,3.3614E-03,3.5351E-03,1.7134E-03,-2.1284E-03,-6.6672E-03,
+-9.1797E-03,-6.7814E-03,1.3921E-03,1.2474E-02,2.0274E-02,1.8361E-02,
+4.4723E-03,-1.6553E-02,-3.3853E-02,-3.5967E-02,-1.8001E-02,1.3848E-02,
+4.3889E-02,5.4747E-02,3.7466E-02,-2.0394E-03,-4.4605E-02,-6.7442E-02,
+-5.6767E-02,-1.6218E-02,3.4174E-02,6.8355E-02
+};
+
+const Float h_half_6k[N/2] = {
+-2.9270E-03,-1.3224E-03,1.5357E-03,4.4992E-03,5.5890E-03,2.8964E-03,
+-3.6114E-03,-1.0769E-02,-1.3136E-02,-6.5479E-03,7.7716E-03,2.1970E-02,
+2.5395E-02,1.2010E-02,-1.3554E-02,-3.6524E-02,-4.0344E-02,-1.8277E-02,
+1.9801E-02,5.1324E-02,5.4626E-02,2.3881E-02,-2.5000E-02,-6.2683E-02,
+-6.4597E-02,-2.7364E-02,2.7775E-02,6.7556E-02
+};
+
+const Float h_half_7k[N/2] = {
+3.1561E-03,2.2746E-03,-7.8160E-04,-4.3603E-03,-5.4165E-03,-1.4741E-03,
+6.2118E-03,1.1611E-02,7.8863E-03,-5.4908E-03,-1.9198E-02,-1.9739E-02,
+-1.7947E-03,2.3556E-02,3.4679E-02,1.7456E-02,-1.9282E-02,-4.6764E-02,
+-3.8837E-02,3.6273E-03,4.9080E-02,5.8993E-02,2.0964E-02,-3.7631E-02,
+-6.9652E-02,-4.7068E-02,1.4136E-02,6.5471E-02
+};
+
+const Float h_half_8k[N/2] = {
+-2.7394E-03,-2.9880E-03,-2.9375E-18,4.2109E-03,5.2309E-03,-6.9252E-18,
+-8.1600E-03,-1.0079E-02,1.1036E-17,1.4795E-02,1.7560E-02,-1.5736E-17,
+-2.3768E-02,-2.7137E-02,1.8512E-17,3.4184E-02,3.7759E-02,2.5808E-17,
+-4.4741E-02,-4.8036E-02,2.0475E-17,5.3959E-02,5.6488E-02,0.0000E+00,
+-6.0458E-02,-6.1830E-02,4.8351E-17,6.3227E-02
+};
+
+const Float h_half_9k[N/2] = {
+1.7601E-03,3.3892E-03,7.8290E-04,-4.0491E-03,-5.0299E-03,1.4766E-03,
+9.2555E-03,6.4756E-03,-7.8994E-03,-1.6782E-02,-3.9618E-03,1.9772E-02,
+2.2854E-02,-6.1225E-03,-3.4737E-02,-2.1963E-02,2.4260E-02,4.6841E-02,
+1.0094E-02,-4.6190E-02,-4.9161E-02,1.2174E-02,6.4071E-02,3.7693E-02,
+-3.8844E-02,-7.0131E-02,-1.4159E-02,6.0797E-02
+};
+
+const Float h_half_10k[N/2] = {
+-4.1409E-04,-3.4307E-03,-1.5378E-03,3.8688E-03,4.8059E-03,-2.9004E-03,
+-9.3691E-03,-1.5235E-03,1.3154E-02,1.0431E-02,-1.2380E-02,-2.2000E-02,
+3.5927E-03,3.1158E-02,1.3572E-02,-3.1407E-02,-3.4692E-02,1.8302E-02,
+5.1371E-02,7.2611E-03,-5.4701E-02,-3.8041E-02,3.9823E-02,6.2768E-02,
+-9.1388E-03,-7.0991E-02,-2.7813E-02,5.8091E-02
+};
+
+#pragma DATA_ALIGN(h_q15_1k, 2)
+const Int16 h_q15_1k[N] = {
+-93, -107, -129, -159, -197, -242, -292, -341,
+-386, -420, -437, -431, -397, -329, -226, -84,
+93, 304, 543, 802, 1073, 1344, 1604, 1842,
+2048, 2211, 2325, 2383, 2383, 2325, 2211, 2048,
+1842, 1604, 1344, 1073, 802, 543, 304, 93,
+-84, -226, -329, -397, -431, -437, -420, -386,
+-341, -292, -242, -197, -159, -129, -107, -93
+};
+
+#pragma DATA_ALIGN(h_q15_1k5, 2)
+const Int16 h_q15_1k5[N] = {
+66, 54, 38, 16, -20, -72, -146, -243,
+-362, -496, -639, -779, -900, -988, -1028, -1005,
+-911, -741, -494, -179, 191, 596, 1013, 1416,
+1778, 2075, 2285, 2394, 2394, 2285, 2075, 1778,
+1416, 1013, 596, 191, -179, -494, -741, -911,
+-1005, -1028, -988, -900, -779, -639, -496, -362,
+-243, -146, -72, -20, 16, 38, 54, 66
+};
+
+#pragma DATA_ALIGN(h_q15_2k, 2)
+const Int16 h_q15_2k[N] = {
+63, 90, 121, 158, 196, 228, 244, 232,
+178, 73, -87, -297, -546, -813, -1068, -1280,
+-1414, -1441, -1340, -1104, -739, -266, 278, 848,
+1390, 1852, 2189, 2367, 2367, 2189, 1852, 1390,
+848, 278, -266, -739, -1104, -1340, -1441, -1414,
+-1280, -1068, -813, -546, -297, -87, 73, 178,
+232, 244, 228, 196, 158, 121, 90, 63
+};
+
+#pragma DATA_ALIGN(h_q15_2k5, 2)
+const Int16 h_q15_2k5[N] = {
+-95, -83, -62, -26, 32, 117, 226, 349,
+465, 547, 566, 495, 318, 34, -338, -756,
+-1165, -1500, -1698, -1707, -1501, -1082, -487, 218,
+947, 1605, 2101, 2369, 2369, 2101, 1605, 947,
+218, -487, -1082, -1501, -1707, -1698, -1500, -1165,
+-756, -338, 34, 318, 495, 566, 547, 465,
+349, 226, 117, 32, -26, -62, -83, -95
+};
+
+#pragma DATA_ALIGN(h_q15_3k, 2)
+const Int16 h_q15_3k[N] = {
+-20, -63, -109, -157, -194, -206, -172, -75,
+91, 312, 553, 764, 883, 855, 645, 253,
+-279, -869, -1410, -1785, -1900, -1700, -1189, -434,
+447, 1302, 1978, 2350, 2350, 1978, 1302, 447,
+-434, -1189, -1700, -1900, -1785, -1410, -869, -279,
+253, 645, 855, 883, 764, 553, 312, 91,
+-75, -172, -206, -194, -157, -109, -63, -20
+};
+
+#pragma DATA_ALIGN(h_q15_3k5, 2)
+const Int16 h_q15_3k5[N] = {
+104, 103, 83, 36, -45, -157, -281, -381,
+-410, -326, -108, 226, 615, 961, 1153, 1098,
+754, 153, -596, -1326, -1851, -2014, -1737, -1046,
+-75, 965, 1835, 2330, 2330, 1835, 965, -75,
+-1046, -1737, -2014, -1851, -1326, -596, 153, 754,
+1098, 1153, 961, 615, 226, -108, -326, -410,
+-381, -281, -157, -45, 36, 83, 103, 104
+};
+
+#pragma DATA_ALIGN(h_q15_4k, 2)
+const Int16 h_q15_4k[N] = {
+-27, 29, 93, 155, 192, 176, 80, -99,
+-330, -543, -644, -552, -234, 267, 823, 1254,
+1386, 1109, 440, -472, -1373, -1980, -2073, -1576,
+-594, 608, 1686, 2320, 2320, 1686, 608, -594,
+-1576, -2073, -1980, -1373, -472, 440, 1109, 1386,
+1254, 823, 267, -234, -552, -644, -543, -330,
+-99, 80, 176, 192, 155, 93, 29, -27
+};
+
+#pragma DATA_ALIGN(h_q15_4k5, 2)
+const Int16 h_q15_4k5[N] = {
+-91, -112, -101, -46, 57, 191, 307, 336,
+219, -55, -421, -744, -860, -651, -113, 609,
+1259, 1553, 1307, 527, -561, -1576, -2125, -1955,
+-1077, 229, 1505, 2287, 2287, 1505, 229, -1077,
+-1955, -2125, -1576, -561, 527, 1307, 1553, 1259,
+609, -113, -651, -860, -744, -421, -55, 219,
+336, 307, 191, 57, -46, -101, -112, -91
+};
+
+#pragma DATA_ALIGN(h_q15_5k, 2)
+const Int16 h_q15_5k[N] = {
+69, 7, -73, -151, -188, -138, 20, 252,
+458, 504, 295, -152, -679, -1028, -967, -417,
+461, 1304, 1695, 1372, 379, -906, -1924, -2185,
+-1514, -154, 1324, 2274, 2274, 1324, -154, -1514,
+-2185, -1924, -906, 379, 1372, 1695, 1304, 461,
+-417, -967, -1028, -679, -152, 295, 504, 458,
+252, 20, -138, -188, -151, -73, 7, 69
+};
+
+#pragma DATA_ALIGN(h_q15_5k5, 2)
+const Int16 h_q15_5k5[N] = {
+60, 110, 116, 56, -70, -218, -301, -222,
+46, 409, 664, 602, 147, -542, -1109, -1179,
+-590, 454, 1438, 1794, 1228, -67, -1462, -2210,
+-1860, -531, 1120, 2240, 2240, 1120, -531, -1860,
+-2210, -1462, -67, 1228, 1794, 1438, 454, -590,
+-1179, -1109, -542, 147, 602, 664, 409, 46,
+-222, -301, -218, -70, 56, 116, 110, 60
+};
+
+#pragma DATA_ALIGN(h_q15_6k, 2)
+const Int16 h_q15_6k[N] = {
+-96, -43, 50, 147, 183, 95, -118, -353,
+-430, -215, 255, 720, 832, 394, -444, -1197,
+-1322, -599, 649, 1682, 1790, 783, -819, -2054,
+-2117, -897, 910, 2214, 2214, 910, -897, -2117,
+-2054, -819, 783, 1790, 1682, 649, -599, -1322,
+-1197, -444, 394, 832, 720, 255, -215, -430,
+-353, -118, 95, 183, 147, 50, -43, -96
+};
+
+#pragma DATA_ALIGN(h_q15_7k, 2)
+const Int16 h_q15_7k[N] = {
+103, 75, -26, -143, -177, -48, 204, 380,
+258, -180, -629, -647, -59, 772, 1136, 572,
+-632, -1532, -1273, 119, 1608, 1933, 687, -1233,
+-2282, -1542, 463, 2145, 2145, 463, -1542, -2282,
+-1233, 687, 1933, 1608, 119, -1273, -1532, -632,
+572, 1136, 772, -59, -647, -629, -180, 258,
+380, 204, -48, -177, -143, -26, 75, 103
+};
+
+#pragma DATA_ALIGN(h_q15_8k, 2)
+const Int16 h_q15_8k[N] = {
+-90, -98, 0, 138, 171, 0, -267, -330,
+0, 485, 575, 0, -779, -889, 0, 1120,
+1237, 0, -1466, -1574, 0, 1768, 1851, 0,
+-1981, -2026, 0, 2072, 2072, 0, -2026, -1981,
+0, 1851, 1768, 0, -1574, -1466, 0, 1237,
+1120, 0, -889, -779, 0, 575, 485, 0,
+-330, -267, 0, 171, 138, 0, -98, -90
+};
+
+#pragma DATA_ALIGN(h_q15_9k, 2)
+const Int16 h_q15_9k[N] = {
+58, 111, 26, -133, -165, 48, 303, 212,
+-259, -550, -130, 648, 749, -201, -1138, -720,
+795, 1535, 331, -1514, -1611, 399, 2099, 1235,
+-1273, -2298, -464, 1992, 1992, -464, -2298, -1273,
+1235, 2099, 399, -1611, -1514, 331, 1535, 795,
+-720, -1138, -201, 749, 648, -130, -550, -259,
+212, 303, 48, -165, -133, 26, 111, 58
+};
+
+#pragma DATA_ALIGN(h_q15_10k, 2)
+const Int16 h_q15_10k[N] = {
+-14, -112, -50, 127, 157, -95, -307, -50,
+431, 342, -406, -721, 118, 1021, 445, -1029,
+-1137, 600, 1683, 238, -1792, -1247, 1305, 2057,
+-299, -2326, -911, 1904, 1904, -911, -2326, -299,
+2057, 1305, -1247, -1792, 238, 1683, 600, -1137,
+-1029, 445, 1021, 118, -721, -406, 342, 431,
+-50, -307, -95, 157, 127, -50, -112, -14
+};
+
+const Float *h_arrays[] = {h_1k, h_1k5, h_2k, h_2k5, h_3k, h_3k5, h_4k, h_4k5, h_5k, h_5k5, h_6k};
+
+const Float *h_half;
+const Float *h_half_arrays[] = {h_half_1k, h_half_1k5, h_half_2k, h_half_2k5, h_half_3k, h_half_3k5, h_half_4k, h_half_4k5, h_half_5k, h_half_5k5, h_half_6k};
+
+const Int16 *h_q15;
+const Int16 *h_q15_arrays[] = {h_q15_1k, h_q15_1k5, h_q15_2k, h_q15_2k5, h_q15_3k, h_q15_3k5, h_q15_4k, h_q15_4k5, h_q15_5k, h_q15_5k5, h_q15_6k};
+
+const Float *h_half_all[] = {h_half_1k, h_half_1k5, h_half_2k, h_half_2k5, h_half_3k, h_half_3k5, h_half_4k, h_half_4k5, h_half_5k, h_half_5k5, h_half_6k, h_half_7k, h_half_8k, h_half_9k, h_half_10k};
+
+const Float wah_svf_g[WAH_SVF_STEPS + 1] = {
+6.554346E-02,7.333645E-02,8.206342E-02,9.183930E-02,1.027943E-01,1.150766E-01,
+1.288552E-01,1.443239E-01,1.617065E-01,1.812628E-01,2.032974E-01,2.281705E-01,
+2.563140E-01,2.882522E-01,3.246328E-01,3.662706E-01,4.142136E-01
+};
@@ -0,0 +1,48 @@
+/*
+ * bandpass_coeffs_gen.h
+ *
+ * GENERATED by host/gen_coeffs - do not edit.
+ * 56 taps, 48000 Hz, 1000 Hz bandwidth, 11 of 15 tables in the sweep.
+ */
+
+#ifndef BANDPASS_COEFFS_GEN_H_
+#define BANDPASS_COEFFS_GEN_H_
+
+// Define the window size used for each array
+#define N 56
+
+// Define the number of BPF arrays in the effect_wah sweep (h_arrays)
+#define NUM_BPF 11
+
+// Number of arrays in all, which the coefficient-morphing wah
+// (effect_wahMorph) sweeps through
+#define NUM_BPF_ALL 15
+
+// Sample rate the arrays were designed for
+#define WAH_FS 48000.0
+
+// The state-variable wah (effect_wahSvf) sweeps its center frequency
+// continuously over the same range as h_arrays, from WAH_SVF_FMIN to
+// WAH_SVF_FMAX in WAH_SVF_STEPS log-spaced steps
+#define WAH_SVF_STEPS 16
+#define WAH_SVF_FMIN 1000.0
+#define WAH_SVF_FMAX 6000.0
+
+// FIR coefficient arrays, each with a different bandpass center frequency
+extern const Float h_1k[];
+extern const Float h_1k5[];
+extern const Float h_2k[];
+extern const Float h_2k5[];
+extern const Float h_3k[];
+extern const Float h_3k5[];
+extern const Float h_4k[];
+extern const Float h_4k5[];
+extern const Float h_5k[];
+extern const Float h_5k5[];
+extern const Float h_6k[];
+extern const Float h_7k[];
+extern const Float h_8k[];
+extern const Float h_9k[];
+extern const Float h_10k[];
+
+#endif /* BANDPASS_COEFFS_GEN_H_ */
@@ -0,0 +1,353 @@
+/*
+ * cab_ir.c
+ *
+ * GENERATED by host/gen_cab - do not edit.
+ * Cabinet impulse response for effect_cab, kept in flash.
+ */
+
+#include "cab_ir.h"
+
+const Float cab_ir[CAB_IR_LEN] = {
+    0.0015968669, 0.00977719858, 0.0275661731, 0.0485432804, 0.0611319388, 0.059310825,
+    0.0460985697, 0.029101034, 0.0143062406, 0.00323872524, -0.00512626181, -0.0112748349,
+    -0.0153729716, -0.0186780776, -0.0218120402, -0.0227929441, -0.0186690128, -0.00879019921,
+    0.00380715528, 0.014513736, 0.0204900338, 0.0215594473, 0.0194230031, 0.0170931721,
+    0.0172685245, 0.0197658216, 0.0215859466, 0.0204665851, 0.0168652164, 0.0115685444,
+    0.00400440723, -0.00559231439, -0.0150618547, -0.0222830164, -0.0264032336, -0.0274402717,
+    -0.0258390114, -0.0226562926, -0.0195557273, -0.0173344441, -0.0150075633, -0.0113349385,
+    -0.00584422873, 0.00151580286, 0.0096810676, 0.0162033338, 0.0188069482, 0.0170089688,
+    0.0125990399, 0.00855936753, 0.00710855374, 0.00833596737, 0.0106467254, 0.0121696488,
+    0.0110478297, 0.00585689135, -0.00292173177, -0.0126565296, -0.0203827766, -0.0247103455,
+    -0.025815322, -0.0248531668, -0.0239641785, -0.0246811605, -0.0257661298, -0.0244303435,
+    -0.0197003165, -0.0134643153, -0.00864287979, -0.00686663614, -0.00762402658, -0.00943617932,
+    -0.0111373439, -0.0114851579, -0.00905249393, -0.00392434976, 0.00152945463, 0.0045255962,
+    0.00424211322, 0.00185952446, -0.001212097, -0.00372722272, -0.00416570571, -0.0018305625,
+    0.00197366138, 0.00480076139, 0.00506755474, 0.0030740084, -4.05664819e-05, -0.0036552231,
+    -0.00683583059, -0.0079779607, -0.00712061964, -0.00637929182, -0.00718547736, -0.00896924906,
+    -0.010194646, -0.00952756707, -0.00659693585, -0.00235042855, 0.00134829097, 0.00301037264,
+    0.00245452881, 0.000549787901, -0.00162783685, -0.00381707274, -0.00650256794, -0.00969265215,
+    -0.0125596852, -0.0139588753, -0.0130676869, -0.010369011, -0.00763907191, -0.00609549475,
+    -0.0051423424, -0.00344513322, -0.000879553405, 0.0011009033, 0.00145271375, 0.00113160497,
+    0.00164815767, 0.00281650668, 0.00293429023, 0.000852226661, -0.00269741628, -0.00606553224,
+    -0.00840088918, -0.00978114245, -0.0103339891, -0.00970479212, -0.00723494289, -0.00293337994,
+    0.001931346, 0.00574631955, 0.00787780923, 0.00893963435, 0.00997188448, 0.0112318012,
+    0.0117124202, 0.0100668366, 0.00604772413, 0.000831501589, -0.00405399424, -0.00748156677,
+    -0.00852330006, -0.00666358333, -0.00232872831, 0.00335317269, 0.00913181959, 0.0138364418,
+    0.0165116479, 0.0169627476, 0.0159652348, 0.0141457448, 0.011060285, 0.00630215771,
+    0.000867297151, -0.0035496151, -0.00623461284, -0.00765007462, -0.00825263563, -0.00789445648,
+    -0.00617597119, -0.0030856821, 0.000395806152, 0.00267172591, 0.00315090295, 0.00300452489,
+    0.00378335762, 0.00578420415, 0.00789378934, 0.00878416187, 0.00825304879, 0.00712292466,
+    0.00606871425, 0.00513032853, 0.00391303523, 0.00190481102, -0.000714933662, -0.00272069351,
+    -0.00305909937, -0.00218915227, -0.00180167821, -0.00326068681, -0.00637273042, -0.00964386046,
+    -0.011689081, -0.0120693404, -0.010858774, -0.00850929842, -0.00622737863, -0.0052271684,
+    -0.00533522675, -0.0050084895, -0.00294553369, 0.000561014764, 0.00398378232, 0.00601616434,
+    0.00638781913, 0.00574532108, 0.00518626214, 0.00536882062, 0.00598149435, 0.00632590854,
+    0.00609496532, 0.00547809945, 0.00463082641, 0.00336492078, 0.00176834041, 0.000570214708,
+    0.000193645174, 0.000130294478, -0.000187460696, -0.000669036806, -0.00102256241, -0.00122627395,
+    -0.00133415956, -0.00141420074, -0.00174739443, -0.00245674626, -0.00312077941, -0.00315087788,
+    -0.00236354308, -0.00124958319, -0.000615582995, -0.000753687274, -0.00127255763, -0.00172192591,
+    -0.00195489418, -0.00203793102, -0.00193907375, -0.00128367943, 0.000131383275, 0.00174323109,
+    0.00272980123, 0.0027393739, 0.00191123612, 0.000837197894, 0.000433041242, 0.00122917128,
+    0.00284300115, 0.00433438108, 0.00505452828, 0.0050900859, 0.00480995063, 0.00436086808,
+    0.00389190644, 0.00370717142, 0.00382414725, 0.00379109632, 0.00323203298, 0.00234462018,
+    0.00167408959, 0.00155806784, 0.00190904222, 0.00238808715, 0.00264561676, 0.00247211798,
+    0.00193740754, 0.00131442314, 0.00065830239, -0.000263408512, -0.00156431874, -0.0031054878,
+    -0.00468684287, -0.00618828472, -0.00748037585, -0.0082764272, -0.00836444642, -0.00790489972,
+    -0.00715527596, -0.00613171932, -0.00487744384, -0.00371096465, -0.00287933745, -0.00227307585,
+    -0.00166324951, -0.000930678017, -3.581632e-05, 0.000961019576, 0.00182173207, 0.00215923689,
+    0.00168992574, 0.000593194035, -0.000516797897, -0.00105985216, -0.000879193635, -0.000216871025,
+    0.000495991361, 0.000833405456, 0.000678794934, 0.000289133848, -1.55447879e-05, -4.554149e-05,
+    0.000156295325, 0.000316436353, 0.000327375191, 0.00046581361, 0.00097649092, 0.00174699767,
+    0.00242486167, 0.0026284193, 0.002226642, 0.00146370649, 0.000686770131, 2.34060513e-05,
+    -0.000639405473, -0.00134472622, -0.0018758336, -0.0020344721, -0.00181268471, -0.00118434371,
+    -0.000156571394, 0.00100263945, 0.00198992717, 0.00281009666, 0.00364124689, 0.00442932864,
+    0.00479918156, 0.00438956939, 0.00317876581, 0.00156052988, 0.000155334135, -0.000569723104,
+    -0.000530963048, -1.4468643e-05, 0.000448402373, 0.00040549281, -0.00017070963, -0.000956453557,
+    -0.00161845909, -0.00195327814, -0.00190286326, -0.00161267112, -0.00132630622, -0.00115170853,
+    -0.00103094126, -0.00093652116, -0.000939021928, -0.00106066489, -0.00121695371, -0.00123354488,
+    -0.000886655037, -0.000184246977, 0.000491943811, 0.000789272716, 0.000724922686, 0.000520819837,
+    0.000284886126, -8.04103513e-05, -0.000613408826, -0.00104525437, -0.00100607792, -0.00042919721,
+    0.000332662376, 0.000846073453, 0.00104875531, 0.00122237391, 0.00157065542, 0.00201027223,
+    0.00231168433, 0.00231427708, 0.00206491583, 0.00183164464, 0.00188818726, 0.0022343068,
+    0.00265487588, 0.00297988955, 0.00313150176, 0.00306481547, 0.00276851476, 0.00221909615,
+    0.00138115735, 0.00035048234, -0.00060746233, -0.00121957819, -0.00139852373, -0.00130376058,
+    -0.00116006028, -0.00106204259, -0.000996431217, -0.000952525848, -0.00100209183, -0.0012562366,
+    -0.00168157064, -0.00201049145, -0.00194220224, -0.00144505096, -0.00079099085, -0.000290465751,
+    -3.65996176e-05, 5.69803292e-05, 3.04643453e-05, -0.000160159486, -0.000484662991, -0.000757201705,
+    -0.000729888543, -0.000303561868, 0.0003739349, 0.0010825614, 0.00173391585, 0.00234854727,
+    0.00292095467, 0.00340130522, 0.00375476058, 0.00394225229, 0.00390027845, 0.00361391131,
+    0.0031612264, 0.00263133041, 0.00204825747, 0.00139420279, 0.000653450246, -0.000119237183,
+    -0.000762910332, -0.00113068539, -0.00120961218, -0.00105201321, -0.000691101727, -0.000200203596,
+    0.000290426044, 0.000682122891, 0.000944270539, 0.0010960596, 0.00120634351, 0.00138980979,
+    0.00173362036, 0.0022000077, 0.00261301999, 0.00274909247, 0.00249897295, 0.00195481853,
+    0.00130950243, 0.000688804015, 0.000104382183, -0.000426531121, -0.000812853448, -0.000969940756,
+    -0.000872557866, -0.000603894608, -0.000360222241, -0.000269347118, -0.000272819727, -0.000206205468,
+    9.87124148e-05, 0.000685048169, 0.00135228959, 0.00175657404, 0.00168621746, 0.00121021224,
+    0.000614589861, 0.000228817755, 0.000191897241, 0.000371579168, 0.000543050522, 0.000592798453,
+    0.00057983883, 0.000635491036, 0.000798345125, 0.000971669216, 0.00105682978, 0.0010749219,
+    0.00108593922, 0.00105824793, 0.000915791255, 0.000655205531, 0.000345755578, 4.52489439e-05,
+    -0.000245131413, -0.000546713293, -0.000839985133, -0.00105357097, -0.00113792024, -0.00112722451,
+    -0.00107406047, -0.000972748949, -0.000822680965, -0.000667426337, -0.000514941562, -0.000351972846,
+    -0.000216865886, -0.000119870528, 2.13696234e-05, 0.000247205221, 0.000468093784, 0.000589559176,
+    0.000596780842, 0.000514401685, 0.000416588124, 0.000420886208, 0.000588853444, 0.000866689012,
+    0.00111707627, 0.00118060224, 0.000958138801, 0.000512467686, 6.26524086e-05, -0.000193647142,
+    -0.000232277454, -0.00014585982, -9.14800053e-06, 0.000124249997, 0.00017012167, 7.33674944e-05,
+    -0.00010791691, -0.000258553098, -0.000332460405, -0.000370961009, -0.000415428862, -0.000444172067,
+    -0.000402358974, -0.000276172156, -0.000106436237, 5.41240673e-05, 0.000168301141, 0.000232695486,
+    0.000263850085, 0.000243556889, 0.000135191609, -2.06424865e-05, -9.27936791e-05, 5.7429929e-06,
+    0.00020098071, 0.00033595944, 0.000346366331, 0.000300905937, 0.000288107057, 0.000301966628,
+    0.000257380212, 0.000130901631, 9.39711295e-06, -3.02521044e-05, 1.33333185e-05, 0.000102041353,
+    0.000173627988, 0.000161921417, 3.30375452e-05, -0.000192730228, -0.000418950547, -0.000507728564,
+    -0.000382606737, -8.13110264e-05, 0.000276656686, 0.000557900685, 0.000693703541, 0.000709189721,
+    0.000684138397, 0.000692584057, 0.000730440352, 0.000702915463, 0.000535325539, 0.000260989481,
+    -4.01345016e-05, -0.000326666586, -0.000577744783, -0.000760986057, -0.000865562713, -0.000912763179,
+    -0.000915954165, -0.000867570688, -0.000755563186, -0.000582298691, -0.000392884731, -0.000266903917,
+    -0.000240011558, -0.000258195114, -0.000245953606, -0.000190358119, -0.000136259116, -0.000121870392,
+    -0.000136403995, -0.000139021961, -0.000102934405, -2.82765782e-05, 6.95539761e-05, 0.00015321477,
+    0.000171093884, 0.000108941929, -2.49218505e-06, -0.000137156411, -0.000275071779, -0.000366558018,
+    -0.000361080098, -0.000281712889, -0.000223202126, -0.000251564018, -0.000336572615, -0.000402456962,
+    -0.000412015871, -0.000378366955, -0.000325511055, -0.000266814887, -0.000204358875, -0.00013829648,
+    -8.82495395e-05, -8.10778211e-05, -0.000105062227, -0.000122681939, -0.000129039316, -0.000148684727,
+    -0.000191779188, -0.000237480423, -0.000237516492, -0.000154049191, -1.53175523e-05, 0.000103301177,
+    0.000162121383, 0.000178849344, 0.00017040332, 0.000127368547, 6.07763277e-05, 2.7203043e-05,
+    6.90870176e-05, 0.000150935136, 0.000190830396, 0.000143400913, 3.05135988e-05, -9.73400622e-05,
+    -0.000206597709, -0.000277781647, -0.000292703442, -0.000256397642, -0.000199586718, -0.000139469808,
+    -6.64331515e-05, 1.76935706e-05, 7.35428705e-05, 6.02526836e-05, -1.83416536e-05, -0.000125196328,
+    -0.000228918672, -0.000311082079, -0.000360155812, -0.000383914896, -0.000400541509, -0.000403589042,
+    -0.000368265568, -0.000291255428, -0.000199820514, -0.000129526555, -0.000103129945, -0.000119223093,
+    -0.000156826059, -0.000198556886, -0.000238403422, -0.000270777212, -0.000295771867, -0.000314347096,
+    -0.000310951969, -0.000275656196, -0.00023542786, -0.000234138654, -0.000283364753, -0.000348507034,
+    -0.000386239895, -0.000385276766, -0.000365238773, -0.00034153021, -0.00030697043, -0.000253212962,
+    -0.000195531187, -0.000163301595, -0.000167381769, -0.000192869638, -0.000226562601, -0.000272145506,
+    -0.000335433954, -0.000402761565, -0.000440406369, -0.000430013818, -0.000393280095, -0.000362943709,
+    -0.000348204011, -0.000335805591, -0.000309412389, -0.000265099561, -0.000214191006, -0.000176953256,
+    -0.000163885845, -0.000160249529, -0.000146319357, -0.000127648041, -0.000126906158, -0.000149754012,
+    -0.000177319133, -0.000199478648, -0.000231882977, -0.000285187039, -0.000345937545, -0.000395481106,
+    -0.000419498886, -0.000402470231, -0.000339849117, -0.00025680602, -0.00019323908, -0.00016697744,
+    -0.000168953981, -0.00018842594, -0.000224087774, -0.000273271103, -0.000320243817, -0.000341609542,
+    -0.000322014566, -0.00025814175, -0.000158320939, -4.72077958e-05, 4.31589226e-05, 9.6277508e-05,
+    0.000118304034, 0.000119651779, 9.93631361e-05, 5.50311358e-05, -1.96595478e-06, -5.30171863e-05,
+    -8.54813537e-05, -9.47133881e-05, -8.4672334e-05, -6.92677264e-05, -6.21918083e-05, -6.09018542e-05,
+    -5.17241129e-05, -3.37236434e-05, -2.49799088e-05, -4.19371436e-05, -8.46968023e-05, -0.000142695027,
+    -0.00020052677, -0.000243615864, -0.000269585664, -0.000287591163, -0.000300572605, -0.000296056782,
+    -0.000263694715, -0.000211969409, -0.000157462566, -0.000109745072, -7.00719089e-05, -3.57114225e-05,
+    -6.4169275e-06, 1.68776519e-05, 3.59059732e-05, 4.62614697e-05, 3.81929948e-05, 1.30907451e-05,
+    -1.25906493e-05, -2.07262205e-05, -7.81617436e-06, 1.36621659e-05, 3.07730864e-05, 3.84369405e-05,
+    3.54835902e-05, 2.26951148e-05, 2.50381217e-06, -2.07988248e-05, -3.94931676e-05, -4.53572878e-05,
+    -3.85067162e-05, -2.9601606e-05, -2.3817759e-05, -8.93812846e-06, 2.73015332e-05, 7.33758639e-05,
+    0.00010080129, 9.5691801e-05, 7.2389113e-05, 5.3781597e-05, 4.793851e-05, 4.63144014e-05,
+    3.79032268e-05, 1.86178488e-05, -1.03541066e-05, -4.42799181e-05, -7.38802378e-05, -9.06755769e-05,
+    -9.50994664e-05, -9.19711031e-05, -8.03998243e-05, -5.77793659e-05, -3.09911833e-05, -1.38871617e-05,
+    -1.29827342e-05, -1.87937884e-05, -1.37071965e-05, 5.75164348e-06, 2.2512029e-05, 2.40428736e-05,
+    1.79797984e-05, 1.90741123e-05, 3.65724407e-05, 6.86000504e-05, 9.96295082e-05, 0.000112986019,
+    0.000105418016, 8.49777564e-05, 6.32304035e-05, 4.73371774e-05, 3.62453894e-05, 3.09352839e-05,
+    3.94075792e-05, 6.23144825e-05, 8.40143463e-05, 8.77990176e-05, 7.61385721e-05, 6.76152873e-05,
+    7.60727259e-05, 0.000100566016, 0.00013050395, 0.000151540452, 0.000153164634, 0.000136183888,
+    0.000107789782, 7.26810078e-05, 3.43849912e-05, 4.67291414e-07, -1.93693177e-05, -2.10584561e-05,
+    -8.39316846e-06, 1.09024105e-05, 2.62661904e-05, 2.79194095e-05, 1.57056014e-05, -1.73551751e-07,
+    -8.24399948e-06, -2.03606605e-06, 1.90711777e-05, 4.96261329e-05, 7.87933615e-05, 9.50061011e-05,
+    9.4013577e-05, 8.24552736e-05, 7.17609082e-05, 6.87755948e-05, 7.47202294e-05, 9.05522172e-05,
+    0.000114504771, 0.00013530492, 0.000138330037, 0.000120551873, 9.18040085e-05, 6.15277486e-05,
+    3.24145923e-05, 6.24026529e-06, -1.31514853e-05, -2.5594618e-05, -3.57517338e-05, -4.52107435e-05,
+    -4.93788599e-05, -4.24467759e-05, -2.37239157e-05, -5.58767772e-07, 1.88237885e-05, 3.49097037e-05,
+    5.2831185e-05, 7.21869166e-05, 8.88805387e-05, 0.000102585127, 0.000114187658, 0.000120825032,
+    0.000119391725, 0.000111569523, 0.000102591891, 9.60027828e-05, 9.20191085e-05, 9.02073408e-05,
+    9.05638984e-05, 9.23432355e-05, 9.31487969e-05, 8.98740504e-05, 8.06542338e-05, 6.56166054e-05,
+    4.68076301e-05, 2.82227299e-05, 1.50894633e-05, 1.11457068e-05, 1.65414716e-05, 2.75482416e-05,
+    3.63431059e-05, 3.59394084e-05, 2.81595651e-05, 2.27599486e-05, 2.89454451e-05, 4.87767164e-05,
+    7.60569281e-05, 0.000100220329, 0.000114062557, 0.000120163394, 0.000126999382, 0.000138103289,
+    0.000148170059, 0.000148053024, 0.00013159914, 0.000100438465, 6.3544906e-05, 3.12804997e-05,
+    1.01331309e-05, 2.31199054e-06, 7.0227496e-06, 2.01590427e-05, 3.54400198e-05, 4.95283841e-05,
+    6.44760303e-05, 8.30551481e-05, 0.00010425073, 0.000124927073, 0.000143431434, 0.000158792998,
+    0.000166926017, 0.000161451237, 0.000140025033, 0.000106781969, 6.91247657e-05, 3.5240995e-05,
+    1.12755275e-05, -5.32533404e-07, 5.17443492e-07, 1.30880625e-05, 3.05714803e-05, 4.4462244e-05,
+    5.07115133e-05, 5.06309066e-05, 4.81295262e-05, 4.70887637e-05, 4.965527e-05, 5.48908739e-05,
+    5.89886229e-05, 5.96021769e-05, 5.91850744e-05, 6.10939967e-05, 6.39556121e-05, 6.3353611e-05,
+    5.81761919e-05, 5.14580439e-05, 4.51658291e-05, 3.80291766e-05, 2.97249008e-05, 2.40019907e-05,
+    2.54826425e-05, 3.42555389e-05, 4.49291499e-05, 5.24293843e-05, 5.6835735e-05, 5.93470346e-05,
+    5.76764271e-05, 5.01507582e-05, 3.98506273e-05, 3.06620234e-05, 2.30904209e-05, 1.57744043e-05,
+    7.4597151e-06, -2.42668289e-06, -1.19845736e-05, -1.6202768e-05, -1.0789937e-05, 2.29779027e-06,
+    1.59380081e-05, 2.5694003e-05, 3.16873559e-05, 3.33646567e-05, 2.92522275e-05, 2.10639014e-05,
+    1.35216548e-05, 1.03172478e-05, 1.1944729e-05, 1.66886864e-05, 2.20093163e-05, 2.61284104e-05,
+    2.95161084e-05, 3.43047948e-05, 4.23357279e-05, 5.34666271e-05, 6.57054649e-05, 7.69885289e-05,
+    8.56787552e-05, 8.91254514e-05, 8.35310372e-05, 6.75892428e-05, 4.56740432e-05, 2.4509394e-05,
+    7.29999581e-06, -6.44634271e-06, -1.71507144e-05, -2.3229679e-05, -2.20200141e-05, -1.27687286e-05,
+    1.37104833e-06, 1.47714526e-05, 2.24412348e-05, 2.29543939e-05, 1.87689335e-05, 1.35068101e-05,
+    1.03823275e-05, 1.12979829e-05, 1.42091134e-05, 1.40590254e-05, 8.86355488e-06, 2.07366995e-06,
+    -1.99623934e-06, -2.15508398e-06, 3.31516389e-07, 3.87475191e-06, 7.32055452e-06, 9.6181464e-06,
+    9.86831874e-06, 7.8497199e-06, 4.85770149e-06, 3.77487077e-06, 6.36264999e-06, 1.07866751e-05,
+    1.32471254e-05, 1.19636745e-05, 8.49859756e-06, 4.24363183e-06, -1.95726983e-06, -1.12299145e-05,
+    -2.2042515e-05, -3.08730961e-05, -3.48898936e-05, -3.35449291e-05, -2.75605879e-05, -1.83383502e-05,
+    -9.09902425e-06, -3.81140573e-06, -4.06806785e-06, -9.12597919e-06, -1.75683983e-05, -2.6193383e-05,
+    -3.04041283e-05, -2.90939341e-05, -2.65210475e-05, -2.74566984e-05, -3.22130404e-05, -3.69754775e-05,
+    -3.85453731e-05, -3.73754093e-05, -3.51983632e-05, -3.29614007e-05, -3.21257951e-05, -3.43380523e-05,
+    -3.9295922e-05, -4.48019113e-05, -4.81134646e-05, -4.71685032e-05, -4.22555773e-05, -3.58089756e-05,
+    -3.00821371e-05, -2.65614267e-05, -2.64955681e-05, -3.02028299e-05, -3.63116352e-05, -4.18548515e-05,
+    -4.38760667e-05, -4.17640093e-05, -3.76401288e-05, -3.44000696e-05, -3.28785698e-05, -3.12056721e-05,
+    -2.76114273e-05, -2.27019078e-05, -1.88596212e-05, -1.82540321e-05, -2.12154827e-05, -2.61168775e-05,
+    -3.04718328e-05, -3.28175212e-05, -3.4102952e-05, -3.62927881e-05, -3.99048825e-05, -4.40845215e-05,
+    -4.82949026e-05, -5.28118703e-05, -5.78373415e-05, -6.2415187e-05, -6.45224596e-05, -6.28626311e-05,
+    -5.78997287e-05, -5.06204814e-05, -4.17992258e-05, -3.27997631e-05, -2.55486577e-05, -2.15882759e-05,
+    -2.14522882e-05, -2.42170412e-05, -2.78444221e-05, -3.07751002e-05, -3.30011515e-05, -3.5201992e-05,
+    -3.7183126e-05, -3.77710687e-05, -3.63283116e-05, -3.3563578e-05, -3.07518266e-05, -2.90977413e-05,
+    -2.9161615e-05, -3.02640604e-05, -3.11757725e-05, -3.10926616e-05, -3.03208726e-05, -3.03005299e-05,
+    -3.15405294e-05, -3.25602019e-05, -3.24439854e-05, -3.2351596e-05, -3.33432284e-05, -3.46738804e-05,
+    -3.49109844e-05, -3.34875495e-05, -3.08961778e-05, -2.82283268e-05, -2.65341061e-05, -2.62356534e-05,
+    -2.7097449e-05, -2.83640663e-05, -2.93157532e-05, -2.97853152e-05, -2.95856596e-05, -2.84211778e-05,
+    -2.64524215e-05, -2.39878341e-05, -2.12660561e-05, -1.8896443e-05, -1.76118453e-05, -1.74481771e-05,
+    -1.80860295e-05, -1.9715664e-05, -2.23428883e-05, -2.5078772e-05, -2.70765282e-05, -2.79799612e-05,
+    -2.75428738e-05, -2.60754231e-05, -2.44789554e-05, -2.32499073e-05, -2.24672844e-05, -2.24463783e-05,
+    -2.32114477e-05, -2.3868094e-05, -2.3537493e-05, -2.24272249e-05, -2.12644859e-05, -2.04006282e-05,
+    -2.0073438e-05, -2.04689353e-05, -2.12236499e-05, -2.18483853e-05, -2.2109371e-05, -2.14921122e-05,
+    -1.93333271e-05, -1.57823386e-05, -1.2116476e-05, -9.87783806e-06, -9.68314047e-06, -1.085371e-05,
+    -1.2133559e-05, -1.27357932e-05, -1.27495478e-05, -1.29370903e-05, -1.41689392e-05, -1.67017926e-05,
+    -2.00520931e-05, -2.33729221e-05, -2.59033106e-05, -2.71973184e-05, -2.69340107e-05, -2.52725106e-05,
+    -2.33008714e-05, -2.2147466e-05, -2.20568689e-05, -2.26548857e-05, -2.35507638e-05, -2.45297976e-05,
+    -2.51410367e-05, -2.43789839e-05, -2.14895721e-05, -1.7011739e-05, -1.24354527e-05, -9.19814719e-06,
+    -8.25145801e-06, -9.58929404e-06, -1.1857513e-05, -1.33480596e-05, -1.33748894e-05, -1.20171851e-05,
+    -9.43541103e-06, -6.35735384e-06, -4.16920329e-06, -3.73552413e-06, -4.58244681e-06, -5.48688688e-06,
+    -5.62876887e-06, -5.01951298e-06, -4.26721849e-06, -4.13395112e-06, -4.79355711e-06, -5.51155377e-06,
+    -5.46274514e-06, -4.57472463e-06, -3.18902156e-06, -1.44355635e-06, 4.94624699e-07, 2.05872468e-06,
+    2.78308491e-06, 2.87083711e-06, 2.69467696e-06, 2.2097262e-06, 1.12405628e-06, -7.11507656e-07,
+    -2.77503363e-06, -3.82999668e-06, -2.9916841e-06, -6.13443156e-07, 1.96384349e-06, 3.26966711e-06,
+    2.60534429e-06, 5.01739987e-07, -1.62132762e-06, -2.40964691e-06, -1.44760501e-06, 5.48232295e-07,
+    2.26071483e-06, 2.72875834e-06, 1.95563017e-06, 7.20121831e-07, -9.00759899e-08, -1.32323071e-07,
+    3.71290689e-07, 1.13040536e-06, 2.10317086e-06, 3.42907043e-06, 5.12042072e-06, 6.88641587e-06,
+    8.17940695e-06, 8.50506922e-06, 8.0568742e-06, 7.62697207e-06, 7.57258041e-06, 7.56972545e-06,
+    7.37371114e-06, 7.10484196e-06, 6.90809189e-06, 6.73480195e-06, 6.48834861e-06, 6.36440832e-06,
+    6.8609113e-06, 8.23471044e-06, 1.01182028e-05, 1.17844675e-05, 1.26181175e-05, 1.24205446e-05,
+    1.14761865e-05, 1.03368591e-05, 9.59881249e-06, 9.69769573e-06, 1.05643179e-05, 1.17577774e-05,
+    1.30527058e-05, 1.43862306e-05, 1.54123843e-05, 1.57194787e-05, 1.53199541e-05, 1.46343409e-05,
+    1.4107784e-05, 1.38513986e-05, 1.3700378e-05, 1.36507054e-05, 1.38831274e-05, 1.42111759e-05,
+    1.40354273e-05, 1.31395038e-05, 1.20432155e-05, 1.13647977e-05, 1.13049422e-05, 1.17370971e-05,
+    1.2377521e-05, 1.29885237e-05, 1.35493822e-05, 1.42002887e-05, 1.50680635e-05, 1.59637828e-05,
+    1.63514902e-05, 1.5875663e-05, 1.47182127e-05, 1.34526127e-05, 1.27281886e-05, 1.28500499e-05,
+    1.36078013e-05, 1.46371971e-05, 1.56928438e-05, 1.64856314e-05, 1.67013468e-05, 1.63696223e-05,
+    1.59218684e-05, 1.58002034e-05, 1.61337027e-05, 1.67349304e-05, 1.72389339e-05, 1.72501163e-05,
+    1.65652517e-05, 1.53398386e-05, 1.39265935e-05, 1.2557796e-05, 1.13624817e-05, 1.05788608e-05,
+    1.04149582e-05, 1.08040781e-05, 1.14608431e-05, 1.19903003e-05, 1.20707535e-05, 1.1799781e-05,
+    1.16609356e-05, 1.20905233e-05, 1.32002885e-05, 1.46873188e-05, 1.59657018e-05, 1.6627233e-05,
+    1.67139488e-05, 1.64258337e-05, 1.57917035e-05, 1.48048715e-05, 1.36822058e-05, 1.27801031e-05,
+    1.22538723e-05, 1.19545122e-05, 1.17321958e-05, 1.15723338e-05, 1.14391173e-05, 1.13813029e-05,
+    1.16410889e-05, 1.23442632e-05, 1.33090996e-05, 1.4202227e-05, 1.46694838e-05, 1.44852606e-05,
+    1.3769071e-05, 1.29539316e-05, 1.24598275e-05, 1.23749684e-05, 1.24180372e-05, 1.22753643e-05,
+    1.19882286e-05, 1.18242895e-05, 1.18226458e-05, 1.17712906e-05, 1.15639793e-05, 1.1338267e-05,
+    1.13148764e-05, 1.1616178e-05, 1.22066311e-05, 1.2910999e-05, 1.35218417e-05, 1.39621304e-05,
+    1.42884551e-05, 1.4572753e-05, 1.48304388e-05, 1.49434046e-05, 1.46520817e-05, 1.37588019e-05,
+    1.23624389e-05, 1.08904709e-05, 9.8850866e-06, 9.61275769e-06, 9.82712285e-06, 1.00324011e-05,
+    9.95153928e-06, 9.65035023e-06, 9.32052731e-06, 9.01389153e-06, 8.59375682e-06, 7.99429564e-06,
+    7.39951646e-06, 7.05386343e-06, 7.04269014e-06, 7.30768765e-06, 7.72702271e-06, 8.10207153e-06,
+    8.19688806e-06, 8.00284273e-06, 7.84767356e-06, 8.03644754e-06, 8.51725471e-06, 8.96678558e-06,
+    9.07061535e-06, 8.71876484e-06, 8.04278767e-06, 7.3382036e-06, 6.89193343e-06, 6.77523425e-06,
+    6.84772295e-06, 6.97732096e-06, 7.14341084e-06, 7.36276569e-06, 7.59589234e-06, 7.69953437e-06,
+    7.53201209e-06, 7.13575025e-06, 6.7183821e-06, 6.46093231e-06, 6.36844586e-06, 6.26527236e-06,
+    5.93993217e-06, 5.3237492e-06, 4.55627626e-06, 3.84684833e-06, 3.29349017e-06, 2.93051826e-06,
+    2.8511223e-06, 3.12498185e-06, 3.63835971e-06, 4.11715212e-06, 4.33349889e-06, 4.26243312e-06,
+    4.01513817e-06, 3.68086452e-06, 3.3064469e-06, 2.9672407e-06, 2.75215809e-06, 2.68163754e-06,
+    2.69786024e-06, 2.73189558e-06, 2.72198816e-06, 2.59892786e-06, 2.34310337e-06, 1.99145564e-06,
+    1.56976596e-06, 1.12006768e-06, 7.05627683e-07, 3.60251628e-07, 1.3080818e-07, 4.84851181e-08,
+    2.61706291e-08, -5.94699201e-08, -2.12749994e-07, -3.40426873e-07, -3.80876755e-07, -3.59265689e-07,
+    -3.60390102e-07, -4.86647646e-07, -7.93254734e-07, -1.1972265e-06, -1.49530214e-06, -1.5568779e-06,
+    -1.44250839e-06, -1.30382808e-06, -1.23625572e-06, -1.21934637e-06, -1.18740935e-06, -1.15292507e-06,
+    -1.20668931e-06, -1.41007598e-06, -1.71930833e-06, -1.97361375e-06, -1.99936821e-06, -1.80231153e-06,
+    -1.58403605e-06, -1.56297083e-06, -1.83617717e-06, -2.30268515e-06, -2.69663598e-06, -2.82575189e-06,
+    -2.74348687e-06, -2.60192542e-06, -2.46481669e-06, -2.3703343e-06, -2.40035923e-06, -2.57655873e-06,
+    -2.81115319e-06, -2.97705277e-06, -2.99824583e-06, -2.93722847e-06, -2.94815257e-06, -3.11389296e-06,
+    -3.40130301e-06, -3.72416436e-06, -4.02025205e-06, -4.30404937e-06, -4.57814841e-06, -4.75491127e-06,
+    -4.78749142e-06, -4.74397443e-06, -4.67717992e-06, -4.56617131e-06, -4.40440761e-06, -4.26069549e-06,
+    -4.24177341e-06, -4.39640813e-06, -4.65070693e-06, -4.84916457e-06, -4.86874878e-06, -4.70558339e-06,
+    -4.47532928e-06, -4.34170018e-06, -4.44190636e-06, -4.8242545e-06, -5.38151215e-06, -5.87970054e-06,
+    -6.11858586e-06, -6.0791171e-06, -5.93059865e-06, -5.87206602e-06, -5.93591337e-06, -5.99164419e-06,
+    -5.95543365e-06, -5.91477533e-06, -6.01389105e-06, -6.28471833e-06, -6.63878172e-06, -6.96962972e-06,
+    -7.20215653e-06, -7.2882579e-06, -7.22555346e-06, -7.07496115e-06, -6.92937942e-06, -6.8490459e-06,
+    -6.81928234e-06, -6.79135014e-06, -6.74101244e-06, -6.66306288e-06, -6.5718781e-06, -6.51460632e-06,
+    -6.53708453e-06, -6.63695115e-06, -6.76460951e-06, -6.86949138e-06, -6.91842165e-06, -6.87661594e-06,
+    -6.72372361e-06, -6.4997223e-06, -6.30592857e-06, -6.22428253e-06, -6.25002935e-06, -6.33903871e-06,
+    -6.46695044e-06, -6.61389552e-06, -6.74566512e-06, -6.83858373e-06, -6.91403086e-06, -7.008882e-06,
+    -7.11460034e-06, -7.18855239e-06, -7.19959699e-06, -7.14271861e-06, -7.03973682e-06, -6.92608233e-06,
+    -6.81143501e-06, -6.66465913e-06, -6.47392143e-06, -6.29653637e-06, -6.20855301e-06, -6.22290721e-06,
+    -6.28632792e-06, -6.34677766e-06, -6.3877997e-06, -6.41293696e-06, -6.43030442e-06, -6.43602079e-06,
+    -6.41708362e-06, -6.37338448e-06, -6.31102087e-06, -6.23813973e-06, -6.16831186e-06, -6.10193062e-06,
+    -6.04104959e-06, -6.02035949e-06, -6.08466286e-06, -6.24269605e-06, -6.44149615e-06, -6.58689462e-06,
+    -6.60893855e-06, -6.50252795e-06, -6.3171268e-06, -6.12437831e-06, -5.97131122e-06, -5.86490792e-06,
+    -5.79542473e-06, -5.73419642e-06, -5.63530599e-06, -5.49113198e-06, -5.36277147e-06, -5.31876924e-06,
+    -5.36402739e-06, -5.44798739e-06, -5.51778488e-06, -5.54160675e-06, -5.49012289e-06, -5.32956738e-06,
+    -5.0560755e-06, -4.72341314e-06, -4.42688887e-06, -4.26245295e-06, -4.27247732e-06, -4.39972763e-06,
+    -4.52051127e-06, -4.55074575e-06, -4.50325278e-06, -4.43850823e-06, -4.38410784e-06, -4.31937383e-06,
+    -4.22442529e-06, -4.12503626e-06, -4.08017153e-06, -4.1102587e-06, -4.15599067e-06, -4.13436245e-06,
+    -4.02181119e-06, -3.86840409e-06, -3.73625786e-06, -3.64144281e-06, -3.56754057e-06, -3.51316617e-06,
+    -3.49519626e-06, -3.52358724e-06, -3.59076534e-06, -3.66161849e-06, -3.68428546e-06, -3.62813912e-06,
+    -3.49081001e-06, -3.28653872e-06, -3.06081854e-06, -2.88002165e-06, -2.76710934e-06, -2.67629303e-06,
+    -2.54653292e-06, -2.35517454e-06, -2.13022779e-06, -1.93022769e-06, -1.79927087e-06, -1.73761173e-06,
+    -1.71434811e-06, -1.69454814e-06, -1.65918447e-06, -1.61411029e-06, -1.58611442e-06, -1.60529306e-06,
+    -1.67863555e-06, -1.77703387e-06, -1.84635217e-06, -1.83793847e-06, -1.74833329e-06, -1.62831721e-06,
+    -1.53318755e-06, -1.46435589e-06, -1.3827296e-06, -1.26956985e-06, -1.13957113e-06, -1.0175069e-06,
+    -9.34669521e-07, -9.13120461e-07, -9.27549869e-07, -9.17549473e-07, -8.54756012e-07, -7.63643719e-07,
+    -6.72914517e-07, -5.8393519e-07, -4.90359533e-07, -4.03008729e-07, -3.44622553e-07, -3.29758664e-07,
+    -3.52223056e-07, -3.86096215e-07, -4.07131285e-07, -4.09385622e-07, -3.90517842e-07, -3.4117e-07,
+    -2.55506739e-07, -1.32549806e-07, 2.42509748e-08, 1.96989418e-07, 3.56574406e-07, 4.77395876e-07,
+    5.45417275e-07, 5.65873501e-07, 5.64411887e-07, 5.6389406e-07, 5.60144247e-07, 5.38005863e-07,
+    5.10599413e-07, 5.20204364e-07, 5.90511933e-07, 6.979385e-07, 8.07024773e-07, 9.10072238e-07,
+    1.01278508e-06, 1.11213067e-06, 1.20304417e-06, 1.28258038e-06, 1.34629928e-06, 1.39119157e-06,
+    1.41648016e-06, 1.42642232e-06, 1.43814578e-06, 1.47239374e-06, 1.53322568e-06, 1.60265646e-06,
+    1.65444047e-06, 1.67923969e-06, 1.68903822e-06, 1.69377424e-06, 1.69798707e-06, 1.71722696e-06,
+    1.76935833e-06, 1.85025663e-06, 1.93761209e-06, 2.0168618e-06, 2.0861932e-06, 2.14447759e-06,
+    2.19253882e-06, 2.23926585e-06, 2.2923636e-06, 2.34187133e-06, 2.36630593e-06, 2.36357376e-06,
+    2.35734188e-06, 2.36358418e-06, 2.37338177e-06, 2.37007684e-06, 2.34732731e-06, 2.31803036e-06,
+    2.30712539e-06, 2.33085083e-06, 2.3850717e-06, 2.44705206e-06, 2.49259441e-06, 2.51760029e-06,
+    2.53670871e-06, 2.56760117e-06, 2.6176164e-06, 2.67421978e-06, 2.71781423e-06, 2.74865337e-06,
+    2.7872568e-06, 2.85000842e-06, 2.93138563e-06, 3.00271016e-06, 3.02673769e-06, 2.9855121e-06,
+    2.90030487e-06, 2.8187699e-06, 2.77528439e-06, 2.7681775e-06, 2.7772795e-06, 2.78681378e-06,
+    2.79177206e-06, 2.79844831e-06, 2.81600561e-06, 2.8446486e-06, 2.87751122e-06, 2.91246574e-06,
+    2.95605127e-06, 3.01225252e-06, 3.07374527e-06, 3.12700214e-06, 3.15885731e-06, 3.16089423e-06,
+    3.13234915e-06, 3.07882698e-06, 3.00974701e-06, 2.93484803e-06, 2.86500919e-06, 2.81787974e-06,
+    2.80890174e-06, 2.82969757e-06, 2.85026319e-06, 2.84993306e-06, 2.83510848e-06, 2.8240956e-06,
+    2.82955363e-06, 2.85882442e-06, 2.91242789e-06, 2.97586377e-06, 3.02563824e-06, 3.04931428e-06,
+    3.05442745e-06, 3.05710047e-06, 3.06760592e-06, 3.082279e-06, 3.08373662e-06, 3.0547821e-06,
+    2.99495279e-06, 2.92189872e-06, 2.85496805e-06, 2.80079494e-06, 2.76017113e-06, 2.7370281e-06,
+    2.73185139e-06, 2.73698048e-06, 2.74569338e-06, 2.75986797e-06, 2.77865595e-06, 2.78793121e-06,
+    2.77404556e-06, 2.73740231e-06, 2.68862931e-06, 2.64375664e-06, 2.61742878e-06, 2.60998107e-06,
+    2.60524937e-06, 2.58618374e-06, 2.55007029e-06, 2.50572926e-06, 2.46290544e-06, 2.4280587e-06,
+    2.40284e-06, 2.38459844e-06, 2.37259721e-06, 2.3698116e-06, 2.37333896e-06, 2.37195039e-06,
+    2.35945857e-06, 2.34203587e-06, 2.32754228e-06, 2.31231745e-06, 2.28398374e-06, 2.2376395e-06,
+    2.18496001e-06, 2.14350094e-06, 2.11953757e-06, 2.10557352e-06, 2.09033647e-06, 2.0690975e-06,
+    2.04716058e-06, 2.03024915e-06, 2.01375888e-06, 1.98772667e-06, 1.94682645e-06, 1.89163331e-06,
+    1.82651423e-06, 1.75963415e-06, 1.7008561e-06, 1.65441076e-06, 1.61536032e-06, 1.57593405e-06,
+    1.5340055e-06, 1.49538731e-06, 1.46607107e-06, 1.44407606e-06, 1.42380923e-06, 1.40258726e-06,
+    1.3802168e-06, 1.35872586e-06, 1.33953841e-06, 1.31781151e-06, 1.28546928e-06, 1.24129503e-06,
+    1.19477244e-06, 1.15836938e-06, 1.13658194e-06, 1.12338665e-06, 1.10950862e-06, 1.09061158e-06,
+    1.0684795e-06, 1.04603115e-06, 1.0230625e-06, 9.97457643e-07, 9.68464346e-07, 9.36948891e-07,
+    9.03137037e-07, 8.64900221e-07, 8.187148e-07, 7.63400349e-07, 7.0458239e-07, 6.52889289e-07,
+    6.15239263e-07, 5.91203768e-07, 5.75440634e-07, 5.60075741e-07, 5.39554667e-07, 5.1370675e-07,
+    4.84869071e-07, 4.5560821e-07, 4.28642584e-07, 4.06196672e-07, 3.87683908e-07, 3.68924873e-07,
+    3.47276807e-07, 3.24338584e-07, 3.01270093e-07, 2.77671476e-07, 2.54170537e-07, 2.30314908e-07,
+    2.0343821e-07, 1.73188536e-07, 1.43221791e-07, 1.17197981e-07, 9.64703974e-08, 7.99868185e-08,
+    6.44481919e-08, 4.81686684e-08, 3.37444484e-08, 2.36811369e-08, 1.54560072e-08, 2.71374504e-09,
+    -1.86059525e-08, -4.60065074e-08, -7.31026481e-08, -9.56807988e-08, -1.14256694e-07, -1.31792852e-07,
+    -1.49936873e-07, -1.67291841e-07, -1.82255866e-07, -1.96412411e-07, -2.1199007e-07, -2.27258394e-07,
+    -2.37759092e-07, -2.4164035e-07, -2.40909793e-07, -2.3852647e-07, -2.37818429e-07, -2.42743057e-07,
+    -2.54733178e-07, -2.7044783e-07, -2.8556172e-07, -2.99359538e-07, -3.12726029e-07, -3.24200455e-07,
+    -3.3171673e-07, -3.36503562e-07, -3.42033334e-07, -3.49697568e-07, -3.58018806e-07, -3.65295915e-07,
+    -3.70994345e-07, -3.75337706e-07, -3.78540012e-07, -3.80469464e-07, -3.81173264e-07, -3.81532418e-07,
+    -3.82687929e-07, -3.84847238e-07, -3.87332313e-07, -3.89291835e-07, -3.9026685e-07, -3.90568137e-07,
+    -3.90818702e-07, -3.91568071e-07, -3.93367586e-07, -3.9629503e-07, -3.99527795e-07, -4.01476259e-07,
+    -4.00509454e-07, -3.96495298e-07, -3.91244102e-07, -3.86544669e-07, -3.82449277e-07, -3.77963255e-07,
+    -3.72523784e-07, -3.66623837e-07, -3.61761967e-07, -3.59492516e-07, -3.59906635e-07, -3.61637761e-07,
+    -3.63324862e-07, -3.64010632e-07, -3.62747158e-07, -3.59099479e-07, -3.53703047e-07, -3.47836205e-07,
+    -3.42421463e-07, -3.37485409e-07, -3.32665577e-07, -3.27817726e-07, -3.22915325e-07, -3.17886375e-07,
+    -3.12835895e-07, -3.07890666e-07, -3.02633e-07, -2.96455061e-07, -2.89467074e-07, -2.82380141e-07,
+    -2.75681974e-07, -2.69249905e-07, -2.62640285e-07, -2.55575605e-07, -2.48109513e-07, -2.40639216e-07,
+    -2.33798384e-07, -2.27837421e-07, -2.222954e-07, -2.16662001e-07, -2.10927637e-07, -2.05458112e-07,
+    -2.00670496e-07, -1.96665425e-07, -1.93088353e-07, -1.89364396e-07, -1.85073221e-07, -1.8019024e-07,
+    -1.74858001e-07, -1.69029119e-07, -1.62665062e-07, -1.56131352e-07, -1.50090867e-07, -1.44976694e-07,
+    -1.40591141e-07, -1.36309777e-07, -1.3168987e-07, -1.26704055e-07, -1.21462999e-07, -1.16034454e-07,
+    -1.10553996e-07, -1.05271342e-07, -1.00420426e-07, -9.60870875e-08, -9.21084826e-08, -8.81112951e-08,
+    -8.38096941e-08, -7.92573476e-08, -7.47350046e-08, -7.04464023e-08, -6.64067741e-08, -6.26002285e-08,
+    -5.90910703e-08, -5.58955218e-08, -5.28767849e-08, -4.99041336e-08, -4.69898436e-08, -4.41494426e-08,
+    -4.12925666e-08, -3.83577936e-08, -3.54287064e-08, -3.26480565e-08, -3.00997169e-08, -2.77895742e-08,
+    -2.56492597e-08, -2.35700743e-08, -2.14898506e-08, -1.9428945e-08, -1.74539742e-08, -1.56251908e-08,
+    -1.3964967e-08, -1.24644492e-08, -1.10937871e-08, -9.81086626e-09, -8.58927512e-09, -7.43183487e-09,
+    -6.3553267e-09, -5.37342916e-09, -4.4881395e-09, -3.69131355e-09, -2.97339237e-09, -2.32916304e-09,
+    -1.75932536e-09, -1.26877965e-09, -8.6163707e-10, -5.3810691e-10, -2.95168222e-10, -1.28022557e-10,
+    -3.12919103e-11, -0
+};
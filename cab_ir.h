@@ -0,0 +1,19 @@
+/*
+ * cab_ir.h
+ *
+ * GENERATED by host/gen_cab - do not edit.
+ * 2048 taps at 48000 Hz, synthetic 4x12.
+ */
+
+#ifndef CAB_IR_H_
+#define CAB_IR_H_
+
+#include <xdc/std.h>
+
+// Length of the cabinet impulse response
+#define CAB_IR_LEN 2048
+
+// Cabinet impulse response, peak gain 0 dB
+extern const Float cab_ir[CAB_IR_LEN];
+
+#endif /* CAB_IR_H_ */
@@ -0,0 +1,22 @@
+/*
+ * delay_line.c
+ *
+ * Circular delay line with a mirrored tail, see delay_line.h.
+ */
+
+#include "delay_line.h"
+
+/* ======== delay_init ======== */
+// Points the line at buf, fills it with silence including the mirrored region
+// and resets the write index.
+//
+void delay_init(delay_line *d, Int16 *buf, UInt16 length)
+{
+    UInt16 j;
+
+    d->buf = buf;
+    d->mask = length - 1;
+    d->i = 0;
+
+    for(j = 0; j < length + DELAY_MIRROR_LEN; j++) buf[j] = 0;
+}
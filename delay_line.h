@@ -0,0 +1,68 @@
+/*
+ * delay_line.h
+ *
+ * Circular delay line shared by the delay-based effects. The length is a
+ * power of two, so a read at any delay is (i - m) & mask with no compare
+ * or branch. The first DELAY_MIRROR_LEN samples of the line are repeated
+ * after its end, so a window of up to DELAY_MIRROR_LEN samples starting
+ * at any position is contiguous in memory and the effects can walk it
+ * with a plain pointer instead of checking for the wrap on every sample.
+ */
+
+#ifndef DELAY_LINE_H_
+#define DELAY_LINE_H_
+
+#include <xdc/std.h>
+
+// Longest window delay_ptr() guarantees to be contiguous. Must be a multiple
+// of the frame length, so a frame is either entirely inside the mirrored
+// region or entirely outside it.
+#define DELAY_MIRROR_LEN 128
+
+// Longest delay a frame of n samples can read from a line of the given
+// length without reaching the samples the frame is overwriting
+#define DELAY_MAX(length, n) ((length) - (n))
+
+typedef struct {
+    Int16 *buf; // mask + 1 + DELAY_MIRROR_LEN Q15 samples
+    UInt16 mask; // Circular length - 1, the length being a power of two
+    UInt16 i; // Index of the frame being processed
+} delay_line;
+
+// Fills the line with silence and points it at buf
+// (length + DELAY_MIRROR_LEN elements).
+// length must be a power of two and a multiple of the frame length.
+void delay_init(delay_line *d, Int16 *buf, UInt16 length);
+
+/* ======== delay_ptr ======== */
+// Returns a pointer to the sample m elements before the one at the
+// write index (0 < m <= length). The DELAY_MIRROR_LEN samples from
+// there on are contiguous.
+//
+static inline Int16 *delay_ptr(const delay_line *d, UInt16 m)
+{
+    return &d->buf[(UInt16)(d->i - m) & d->mask];
+}
+
+/* ======== delay_mirror ======== */
+// Copies the n samples at the write index into the mirrored region if
+// they fall inside it. Call once the frame holds its final values.
+//
+static inline void delay_mirror(delay_line *d, UInt16 n)
+{
+    UInt16 k;
+
+    if(d->i < DELAY_MIRROR_LEN){
+        for(k = 0; k < n; k++) d->buf[d->mask + 1 + d->i + k] = d->buf[d->i + k];
+    }
+}
+
+/* ======== delay_advance ======== */
+// Moves the write index on by one frame of n samples.
+//
+static inline void delay_advance(delay_line *d, UInt16 n)
+{
+    d->i = (d->i + n) & d->mask;
+}
+
+#endif /* DELAY_LINE_H_ */
@@ -0,0 +1,106 @@
+/*
+ * delay_mem.c
+ *
+ * Segmented delay memory in RAMGS0-RAMGS14, see delay_mem.h.
+ */
+
+#include "delay_mem.h"
+
+// One segment per global shared RAM block, each in its own section
+#pragma DATA_SECTION(delay_gs0, "delay_gs0")
+#pragma DATA_SECTION(delay_gs1, "delay_gs1")
+#pragma DATA_SECTION(delay_gs2, "delay_gs2")
+#pragma DATA_SECTION(delay_gs3, "delay_gs3")
+#pragma DATA_SECTION(delay_gs4, "delay_gs4")
+#pragma DATA_SECTION(delay_gs5, "delay_gs5")
+#pragma DATA_SECTION(delay_gs6, "delay_gs6")
+#pragma DATA_SECTION(delay_gs7, "delay_gs7")
+#pragma DATA_SECTION(delay_gs8, "delay_gs8")
+#pragma DATA_SECTION(delay_gs9, "delay_gs9")
+#pragma DATA_SECTION(delay_gs10, "delay_gs10")
+#pragma DATA_SECTION(delay_gs11, "delay_gs11")
+#pragma DATA_SECTION(delay_gs12, "delay_gs12")
+#pragma DATA_SECTION(delay_gs13, "delay_gs13")
+#pragma DATA_SECTION(delay_gs14, "delay_gs14")
+static UInt16 delay_gs0[DELAY_SEG_LEN];
+static UInt16 delay_gs1[DELAY_SEG_LEN];
+static UInt16 delay_gs2[DELAY_SEG_LEN];
+static UInt16 delay_gs3[DELAY_SEG_LEN];
+static UInt16 delay_gs4[DELAY_SEG_LEN];
+static UInt16 delay_gs5[DELAY_SEG_LEN];
+static UInt16 delay_gs6[DELAY_SEG_LEN];
+static UInt16 delay_gs7[DELAY_SEG_LEN];
+static UInt16 delay_gs8[DELAY_SEG_LEN];
+static UInt16 delay_gs9[DELAY_SEG_LEN];
+static UInt16 delay_gs10[DELAY_SEG_LEN];
+static UInt16 delay_gs11[DELAY_SEG_LEN];
+static UInt16 delay_gs12[DELAY_SEG_LEN];
+static UInt16 delay_gs13[DELAY_SEG_LEN];
+static UInt16 delay_gs14[DELAY_SEG_LEN];
+
+// Segment pool, in RAMGS order
+static UInt16 *delay_segs[DELAY_NUM_SEGS] = {
+    delay_gs0, delay_gs1, delay_gs2, delay_gs3,
+    delay_gs4, delay_gs5, delay_gs6, delay_gs7,
+    delay_gs8, delay_gs9, delay_gs10, delay_gs11,
+    delay_gs12, delay_gs13, delay_gs14
+};
+
+static UInt16 delay_segNext = 0; // First free segment in delay_segs
+
+// Half-band decimator taps at offsets 1, 3, 5, 7 and 9 from the centre
+// (least-squares design with the stopband from 0.32 of the input rate,
+// scaled so that no frequency gains)
+const Int16 delay_hbCoeffs[(DELAY_HB_HALF + 1) / 2] = { 10182, -2938, 1289, -548, 196 };
+
+// Cubic Lagrange taps for stored samples j - 1 to j + 2 at 1/4, 1/2 and
+// 3/4 of the way from j to j + 1 (row 0 is unused)
+const Int16 delay_interp[4][4] = {
+    { 0, 32767, 0, 0 },
+    { -1792, 26880, 8960, -1280 },
+    { -2048, 18432, 18432, -2048 },
+    { -1280, 8960, 26880, -1792 }
+};
+
+/* ======== delay_segReset ======== */
+void delay_segReset(void)
+{
+    delay_segNext = 0;
+}
+
+/* ======== delay_segAlloc ======== */
+UInt16 **delay_segAlloc(UInt16 nseg)
+{
+    UInt16 **seg;
+
+    if(nseg == 0 || nseg > DELAY_NUM_SEGS - delay_segNext) return NULL;
+
+    seg = &delay_segs[delay_segNext];
+    delay_segNext += nseg;
+
+    return seg;
+}
+
+/* ======== delay_longInit ======== */
+// Points the line at its segments, fills them with silence
+// and resets the write index.
+//
+void delay_longInit(delay_long *d, UInt16 **seg, UInt16 nseg)
+{
+    UInt16 s, j;
+
+    d->seg = seg;
+    d->len = (UInt32)nseg * DELAY_SEG_LEN;
+    d->i = 0;
+    d->phase = 0;
+#if DELAY_LONG_DIV > 1
+    for(s = 0; s < DELAY_LONG_DIV_BITS; s++){
+        for(j = 0; j < 2 * DELAY_HB_TAPS; j++) d->hb[s].x[j] = 0;
+        d->hb[s].i = 0;
+    }
+#endif
+
+    for(s = 0; s < nseg; s++){
+        for(j = 0; j < DELAY_SEG_LEN; j++) seg[s][j] = 0;
+    }
+}
@@ -0,0 +1,202 @@
+/*
+ * delay_mem.h
+ *
+ * Segmented delay memory for delays of several seconds. The global shared
+ * RAMs (RAMGS0-RAMGS14) are too large together for .ebss and are not one
+ * memory range to the linker, so each block is its own 4096-word segment
+ * in its own linker section (delay_gs0 to delay_gs14, placed by
+ * TMS320F28379D.cmd). RAMGS15 holds the trace ring (trace.h).
+ * delay_segAlloc() hands out runs of segments, and a delay_long line
+ * reaches any sample through its segment table in O(1): the high bits of
+ * the index pick the segment and the low bits the word. A line may have
+ * any number of segments; its index wraps by compare, not by mask.
+ *
+ * A delay_long line stores one sample per DELAY_LONG_DIV input samples,
+ * trading bandwidth for delay: each halving of the rate doubles the delay
+ * the same words reach. Each halving goes through a 19-tap half-band FIR
+ * (flat to 0.18 of its input rate, 1 dB down at 0.21 and 45 dB down from
+ * 0.32), so the band below 0.36 of the store's own rate stays flat with
+ * its aliases 45 dB down; a read between stored samples is a 4-point
+ * Lagrange interpolation. The decimators delay the store by
+ * DELAY_LONG_OFS input samples, which delay_longRead() takes off again.
+ */
+
+#ifndef DELAY_MEM_H_
+#define DELAY_MEM_H_
+
+#include <xdc/std.h>
+
+#define DELAY_SEG_BITS 12
+#define DELAY_SEG_LEN (1L << DELAY_SEG_BITS) // Words per segment (one RAMGS block)
+#define DELAY_NUM_SEGS 15 // RAMGS0-RAMGS14
+
+// log2 of the input samples per stored sample (0, 1 or 2). The default
+// 0 stores every sample and keeps the full band; ECHO_MAX_DELAY lists
+// what each setting gives the echo in delay and bandwidth.
+#ifndef DELAY_LONG_DIV_BITS
+#define DELAY_LONG_DIV_BITS 0
+#endif
+#define DELAY_LONG_DIV (1 << DELAY_LONG_DIV_BITS)
+
+#if DELAY_LONG_DIV_BITS < 0 || DELAY_LONG_DIV_BITS > 2
+#error "DELAY_LONG_DIV_BITS must be 0, 1 or 2"
+#endif
+
+#define DELAY_HB_HALF 9 // Taps either side of the half-band centre (odd offsets only)
+#define DELAY_HB_TAPS (2 * DELAY_HB_HALF + 1)
+// Q15 centre tap. All taps are 0.14 % under a true half-band's, so that
+// no frequency gains and a feedback loop through the line cannot grow.
+#define DELAY_HB_CENTRE 16360
+
+// Input samples by which the half-band decimators delay the store
+#define DELAY_LONG_OFS ((DELAY_HB_HALF - 1) * (DELAY_LONG_DIV - 1))
+
+// Shortest and longest delay in input samples a line of nseg segments
+// can read with delay_longRead(): the interpolator needs the stored
+// samples either side of the two around the read
+#define DELAY_LONG_MIN (DELAY_LONG_DIV > 1 ? 3 * DELAY_LONG_DIV + DELAY_LONG_OFS : 2)
+#define DELAY_LONG_MAX(nseg) (((nseg) * DELAY_SEG_LEN - 2) * DELAY_LONG_DIV)
+
+// History of one half-band decimator
+typedef struct {
+    Int16 x[2 * DELAY_HB_TAPS]; // Last DELAY_HB_TAPS inputs, each stored twice
+    UInt16 i; // Slot of the oldest input, overwritten next
+} delay_hb;
+
+typedef struct {
+    UInt16 **seg; // Segment table
+    UInt32 len; // Stored length
+    UInt32 i; // Index of the next stored sample
+    UInt16 phase; // Input samples since the last one was stored
+#if DELAY_LONG_DIV > 1
+    delay_hb hb[DELAY_LONG_DIV_BITS]; // Decimators, full rate first
+#endif
+} delay_long;
+
+extern const Int16 delay_hbCoeffs[(DELAY_HB_HALF + 1) / 2]; // Q15, offsets 1, 3, ...
+extern const Int16 delay_interp[4][4]; // Q15 Lagrange taps per quarter sample
+
+// Returns every segment to the pool
+void delay_segReset(void);
+
+// Takes nseg consecutive segments from the pool and returns their
+// segment table, or NULL if the pool is exhausted
+UInt16 **delay_segAlloc(UInt16 nseg);
+
+// Silences a line of nseg segments from delay_segAlloc()
+void delay_longInit(delay_long *d, UInt16 **seg, UInt16 nseg);
+
+/* ======== delay_longAt ======== */
+// Returns stored sample j (0 <= j < twice the line length, taken modulo
+// the line length). The segments are plain words; a line keeps Q15
+// samples in them.
+//
+static inline Int16 delay_longAt(const delay_long *d, UInt32 j)
+{
+    if(j >= d->len) j -= d->len;
+
+    return (Int16)d->seg[(UInt16)(j >> DELAY_SEG_BITS)][(UInt16)j & (DELAY_SEG_LEN - 1)];
+}
+
+/* ======== delay_longSat ======== */
+// Rounds a Q30 filter sum to a saturated Q15 sample
+//
+static inline Int16 delay_longSat(Int32 acc)
+{
+    acc = (acc + 16384) >> 15;
+    if(acc > 32767) acc = 32767;
+    else if(acc < -32768) acc = -32768;
+
+    return (Int16)acc;
+}
+
+/* ======== delay_longRead ======== */
+// Returns the input sample m samples before the next one to be written
+// (DELAY_LONG_MIN <= m <= DELAY_LONG_MAX), interpolated from the four
+// stored samples around it.
+//
+static inline Int16 delay_longRead(const delay_long *d, UInt32 m)
+{
+    Int32 q = (Int32)(d->i << DELAY_LONG_DIV_BITS) + d->phase + DELAY_LONG_OFS - (Int32)m;
+    UInt32 j;
+
+    if(q < 0) q += (Int32)(d->len << DELAY_LONG_DIV_BITS);
+    j = (UInt32)q >> DELAY_LONG_DIV_BITS;
+
+#if DELAY_LONG_DIV > 1
+    UInt16 frac = (UInt16)q & (DELAY_LONG_DIV - 1);
+
+    if(frac){
+        const Int16 *c = delay_interp[frac << (2 - DELAY_LONG_DIV_BITS)];
+
+        return delay_longSat((Int32)c[0] * delay_longAt(d, j + d->len - 1) + (Int32)c[1] * delay_longAt(d, j) +
+                             (Int32)c[2] * delay_longAt(d, j + 1) + (Int32)c[3] * delay_longAt(d, j + 2));
+    }
+#endif
+
+    return delay_longAt(d, j);
+}
+
+#if DELAY_LONG_DIV > 1
+/* ======== delay_hbPush ======== */
+// Appends one input sample to a half-band decimator
+//
+static inline void delay_hbPush(delay_hb *h, Int16 v)
+{
+    UInt16 i = h->i;
+
+    h->x[i] = h->x[i + DELAY_HB_TAPS] = v;
+    h->i = (i + 1 == DELAY_HB_TAPS) ? 0 : i + 1;
+}
+
+/* ======== delay_hbOut ======== */
+// Returns the half-band filtered sample DELAY_HB_HALF inputs before the
+// newest one. Only the centre and the odd offsets have taps.
+//
+static inline Int16 delay_hbOut(const delay_hb *h)
+{
+    const Int16 *w = &h->x[h->i]; // Oldest first, centre at DELAY_HB_HALF
+    Int32 acc = (Int32)DELAY_HB_CENTRE * w[DELAY_HB_HALF];
+    UInt16 k;
+
+    for(k = 0; k < (DELAY_HB_HALF + 1) / 2; k++){
+        acc += (Int32)delay_hbCoeffs[k] *
+               ((Int32)w[DELAY_HB_HALF - 1 - 2 * k] + w[DELAY_HB_HALF + 1 + 2 * k]);
+    }
+
+    return delay_longSat(acc);
+}
+#endif
+
+/* ======== delay_longWrite ======== */
+// Appends one input sample. Every DELAY_LONG_DIV samples the output of
+// the decimators is stored and the line moves on.
+//
+static inline void delay_longWrite(delay_long *d, Int16 v)
+{
+    UInt32 j = d->i;
+#if DELAY_LONG_DIV > 1
+    UInt16 phase = d->phase + 1;
+
+    delay_hbPush(&d->hb[0], v);
+    if(phase & 1){
+        d->phase = phase;
+        return;
+    }
+    v = delay_hbOut(&d->hb[0]);
+#endif
+#if DELAY_LONG_DIV > 2
+    delay_hbPush(&d->hb[1], v);
+    if(phase < DELAY_LONG_DIV){
+        d->phase = phase;
+        return;
+    }
+    v = delay_hbOut(&d->hb[1]);
+#endif
+
+    d->seg[(UInt16)(j >> DELAY_SEG_BITS)][(UInt16)j & (DELAY_SEG_LEN - 1)] = (UInt16)v;
+    d->i = (j + 1 == d->len) ? 0 : j + 1;
+    d->phase = 0;
+}
+
+#endif /* DELAY_MEM_H_ */
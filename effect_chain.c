@@ -0,0 +1,240 @@
+/*
+ * effect_chain.c
+ *
+ * Serial effect chain, see effect_chain.h.
+ */
+
+#include <math.h>
+#include <trace.h>
+#include "effect_chain.h"
+
+/* ---- Configuration ---- */
+// The task edits the set chain_pub does not point to, then swaps the
+// pointer and bumps chain_gen. audioOut_swi preempts the task, so it
+// always sees a set that is complete.
+static chain_config chain_sets[2];
+static chain_config * volatile chain_pub = &chain_sets[0];
+static volatile UInt16 chain_gen; // Number of sets published
+
+static chain_config chain_cur; // The Swi's copy of the set it runs
+static UInt16 chain_seen; // chain_gen when chain_cur was taken
+
+/* ---- Crossfade ---- */
+static audio_effect_fxn chain_from[CHAIN_SLOTS]; // Kernel each slot fades out, NULL for its input
+static UInt16 chain_fromMix[CHAIN_SLOTS]; // and its mix
+static Bool chain_fading[CHAIN_SLOTS]; // Slots taking part in the crossfade
+static UInt16 chain_fadePos = CHAIN_FADE_LEN; // Samples of the crossfade done
+static Int16 chain_fadeGain[(1 << CHAIN_FADE_BITS) + 1]; // sin over a quarter cycle, Q15
+static Int16 chain_tmp[AUDIO_FRAME_LEN]; // Output of the kernel fading out
+
+#if CHAIN_SLOTS > 1
+// Input history of slots 1 on; slot s uses chain_line[s - 1], carved
+// from chain_mem by chain_init()
+static Int16 chain_mem[CHAIN_MEM_LEN];
+static Int16 *chain_buf[CHAIN_SLOTS - 1];
+static delay_line chain_line[CHAIN_SLOTS - 1];
+#endif
+
+/* ======== chain_init ======== */
+void chain_init(void)
+{
+    UInt16 s, i, j = 0;
+
+    for(s = 0; s < CHAIN_SLOTS; s++){
+        chain_sets[0].fxn[s] = chain_sets[1].fxn[s] = NULL;
+        chain_sets[0].mix[s] = chain_sets[1].mix[s] = CHAIN_WET;
+        chain_fading[s] = FALSE;
+#if CHAIN_SLOTS > 1
+        if(s > 0){
+            chain_buf[s - 1] = &chain_mem[j];
+            delay_init(&chain_line[s - 1], chain_buf[s - 1], CHAIN_LINE_LEN(s));
+            j += CHAIN_LINE_LEN(s) + DELAY_MIRROR_LEN;
+        }
+#endif
+    }
+    chain_sets[0].fade = chain_sets[1].fade = FALSE;
+    chain_cur = chain_sets[0];
+    chain_pub = &chain_sets[0];
+    chain_gen = 0;
+    chain_seen = 0;
+    chain_fadePos = CHAIN_FADE_LEN;
+
+    for(i = 0; i <= (1 << CHAIN_FADE_BITS); i++)
+        chain_fadeGain[i] = (Int16)(32767.0f * sinf(1.5707963f * i / (1 << CHAIN_FADE_BITS)));
+}
+
+/* ======== chain_edit ======== */
+chain_config *chain_edit(void)
+{
+    chain_config *spare = (chain_pub == &chain_sets[0]) ? &chain_sets[1] : &chain_sets[0];
+
+    *spare = *chain_pub;
+    return spare;
+}
+
+/* ======== chain_publish ======== */
+// The pointer is written before chain_gen, so a Swi that sees the new
+// count also sees the new set.
+//
+void chain_publish(Bool fade)
+{
+    chain_config *spare = (chain_pub == &chain_sets[0]) ? &chain_sets[1] : &chain_sets[0];
+
+    spare->fade = fade;
+    chain_pub = spare;
+    chain_gen++;
+}
+
+/* ======== chain_adopt ======== */
+// Makes c the running set and sets up the crossfade of every slot whose
+// kernel changed. Runs in audioOut_swi between frames.
+//
+static void chain_adopt(const chain_config *c)
+{
+    Bool fade = FALSE;
+    UInt16 s, t;
+
+    for(s = 0; s < CHAIN_SLOTS; s++){
+        audio_effect_fxn old = chain_cur.fxn[s];
+
+        chain_fading[s] = FALSE;
+        if(c->fxn[s] == old) continue;
+
+#if CHAIN_SLOTS > 1
+        // Nothing wrote the history of an idle slot; start it silent
+        if(old == NULL && s > 0) delay_init(&chain_line[s - 1], chain_buf[s - 1], CHAIN_LINE_LEN(s));
+#endif
+
+        if(c->fade){
+            // A kernel that moves runs in its new slot only
+            for(t = 0; t < CHAIN_SLOTS; t++){
+                if(c->fxn[t] == old) old = NULL;
+            }
+            chain_from[s] = old;
+            chain_fromMix[s] = chain_cur.mix[s];
+            chain_fading[s] = TRUE;
+            fade = TRUE;
+        }
+    }
+
+    chain_cur = *c;
+    if(fade) chain_fadePos = 0;
+    trace_log(TRACE_ADOPT, chain_seen, c->fade);
+}
+
+/* ======== chain_runSlot ======== */
+// Runs kernel f (NULL passes x through) over the slot input x into out
+// and blends it with x at the given mix.
+//
+static inline void chain_runSlot(Int16 *out, Int16 *x, UInt16 n, audio_effect_fxn f, UInt16 mix)
+{
+    UInt16 k;
+
+    if(f == NULL){
+        for(k = 0; k < n; k++) out[k] = x[k];
+        return;
+    }
+
+    f(out, x, n);
+
+    if(mix != CHAIN_WET){
+        for(k = 0; k < n; k++)
+            out[k] = audio_sat(x[k] + ((((Int32)out[k] - x[k]) * mix) >> 15));
+    }
+}
+
+/* ======== chain_crossfade ======== */
+// Replaces out with the equal-power mix of out (fading in) and old
+// (fading out) for the next n samples of the crossfade.
+//
+static inline void chain_crossfade(Int16 *out, const Int16 *old, UInt16 n)
+{
+    UInt16 k;
+
+    for(k = 0; k < n; k++){
+        UInt16 i = (chain_fadePos + k) / (CHAIN_FADE_LEN >> CHAIN_FADE_BITS);
+        Int32 g_in = chain_fadeGain[i];
+        Int32 g_out = chain_fadeGain[(1 << CHAIN_FADE_BITS) - i];
+
+        out[k] = audio_sat((out[k] * g_in + old[k] * g_out + 0x4000) >> 15);
+    }
+}
+
+/* ======== chain_process ======== */
+// Each kernel writes its output into the current frame of the next
+// active slot's history (or into y for the last one), so the frame is
+// never copied between slots.
+//
+void chain_process(Int16 *y, UInt16 n)
+{
+    UInt16 act[CHAIN_SLOTS];
+    UInt16 active = 0;
+    UInt16 gen = chain_gen;
+    UInt16 i, s, k;
+
+    // Take a newly published set at the frame boundary, once any
+    // crossfade is over
+    if(gen != chain_seen && chain_fadePos >= CHAIN_FADE_LEN){
+        chain_seen = gen;
+        chain_adopt(chain_pub);
+    }
+
+    for(s = 0; s < CHAIN_SLOTS; s++){
+        if(chain_cur.fxn[s] != NULL || chain_fading[s]) act[active++] = s;
+    }
+
+    if(active == 0){
+        const Int16 *x = &audio_line.buf[audio_line.i];
+
+        for(k = 0; k < n; k++) y[k] = x[k];
+        return;
+    }
+
+#if CHAIN_SLOTS > 1
+    // A first active slot after slot 0 takes the frame into its own line
+    if(act[0] > 0){
+        delay_line *l = &chain_line[act[0] - 1];
+        const Int16 *x = &audio_line.buf[audio_line.i];
+
+        for(k = 0; k < n; k++) l->buf[l->i + k] = x[k];
+        delay_mirror(l, n);
+    }
+#endif
+
+    for(i = 0; i < active; i++){
+        delay_line *in, *next = NULL;
+        Int16 *x, *out = y;
+
+        s = act[i];
+#if CHAIN_SLOTS > 1
+        in = (s == 0) ? &audio_line : &chain_line[s - 1];
+        if(i + 1 < active){
+            next = &chain_line[act[i + 1] - 1];
+            out = &next->buf[next->i];
+        }
+#else
+        in = &audio_line;
+#endif
+        x = &in->buf[in->i];
+
+        audio_in = in;
+        chain_runSlot(out, x, n, chain_cur.fxn[s], chain_cur.mix[s]);
+        if(chain_fading[s]){
+            chain_runSlot(chain_tmp, x, n, chain_from[s], chain_fromMix[s]);
+            chain_crossfade(out, chain_tmp, n);
+        }
+
+        // audioOut_swi moves audio_line on itself
+        if(in != &audio_line) delay_advance(in, n);
+        if(next != NULL) delay_mirror(next, n);
+    }
+
+    audio_in = &audio_line;
+
+    if(chain_fadePos < CHAIN_FADE_LEN){
+        chain_fadePos += n;
+        if(chain_fadePos >= CHAIN_FADE_LEN){
+            for(s = 0; s < CHAIN_SLOTS; s++) chain_fading[s] = FALSE;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * effect_chain.h
+ *
+ * Serial effect chain run by audioOut_swi. A fixed array of CHAIN_SLOTS
+ * slots is processed in order a frame at a time, each non-empty slot with
+ * one call of its kernel, so stacking effects (e.g. wah into echo) costs
+ * one call per slot per frame and nothing per sample beyond the kernels.
+ *
+ * Every slot has its own input history: slot 0 reads audio_line and each
+ * later slot its own delay_line of CHAIN_LINE_LEN(s) samples, which the
+ * non-empty slot before it writes its output straight into (or, if there
+ * is none, audioOut_swi's frame is copied into). Kernels find the history
+ * of the slot being run through audio_in. Each slot also has a mix level,
+ * so it can be blended with its input instead of replacing it.
+ *
+ * The configuration is double buffered. gpio_effect_task fills the spare
+ * set from chain_edit() and hands it over with chain_publish(); the Swi
+ * takes a private copy of the published set at the start of a frame, so
+ * a chain is never seen half-written and nothing is locked or masked.
+ * When a slot changes kernel the Swi runs the old and the new kernel on
+ * the slot input for CHAIN_FADE_LEN samples and crossfades their outputs
+ * with equal-power gains. A set published during a crossfade is picked
+ * up once it is over.
+ *
+ * The kernels keep their state in statics (one set per effect), so a
+ * kernel may only sit in one slot at a time. A kernel that moves to
+ * another slot is not run in its old slot during the crossfade, which
+ * fades from the slot input instead.
+ */
+
+#ifndef EFFECT_CHAIN_H_
+#define EFFECT_CHAIN_H_
+
+#include <xdc/std.h>
+#include <delay_line.h>
+#include <EffectsPedal_audio.h>
+
+// Number of slots. gpio_effect_task fills one per effect switch, plus
+// one for the reverb with AUDIO_REVERB and one for the cab with AUDIO_CAB.
+#ifndef CHAIN_SLOTS
+#define CHAIN_SLOTS (4 + AUDIO_REVERB + AUDIO_CAB)
+#endif
+
+// History of every slot after the first (slot 0 reads audio_line). Only
+// the chorus reads further back than its frame and the wah's window, so
+// only the slot gpio_effect_task gives it, CHAIN_LONG_SLOT, has a line
+// long enough for it; a chorus in any other slot but 0 reads the wrong
+// samples. Powers of two and multiples of every frame length, as
+// buffer_length.
+#define CHAIN_SHORT_LEN 128
+#define CHAIN_LONG_LEN 1024
+#ifndef CHAIN_LONG_SLOT
+#define CHAIN_LONG_SLOT 2
+#endif
+#define CHAIN_LINE_LEN(s) ((s) == CHAIN_LONG_SLOT ? CHAIN_LONG_LEN : CHAIN_SHORT_LEN)
+
+// Words of every line with its mirror
+#define CHAIN_MEM_LEN ((CHAIN_SLOTS - 1) * (CHAIN_SHORT_LEN + DELAY_MIRROR_LEN) + \
+                       (CHAIN_LONG_SLOT < CHAIN_SLOTS ? CHAIN_LONG_LEN - CHAIN_SHORT_LEN : 0))
+
+// Length of the crossfade when a slot changes kernel, in samples
+// (a power of two from 256 to 4096; 512 is 10.7 ms)
+#ifndef CHAIN_FADE_LEN
+#define CHAIN_FADE_LEN 512
+#endif
+
+#define CHAIN_FADE_BITS 8 // log2 of the steps in the fade table
+#define CHAIN_WET 32767 // Slot mix for the kernel output alone
+
+#if CHAIN_SLOTS < 1 || CHAIN_SLOTS > 8
+#error "CHAIN_SLOTS must be 1 to 8"
+#endif
+
+#if CHAIN_FADE_LEN < 256 || CHAIN_FADE_LEN > 4096 || (CHAIN_FADE_LEN & (CHAIN_FADE_LEN - 1))
+#error "CHAIN_FADE_LEN must be a power of two from 256 to 4096"
+#endif
+
+#if CHORUS_DELAY + CHORUS_DEPTH + 2 > DELAY_MAX(CHAIN_LONG_LEN, AUDIO_FRAME_LEN)
+#error "CHAIN_LONG_LEN is too short for the longest chorus delay"
+#endif
+
+#if CHAIN_LONG_SLOT < 1
+#error "CHAIN_LONG_SLOT must be 1 or more"
+#endif
+
+typedef struct {
+    audio_effect_fxn fxn[CHAIN_SLOTS]; // Kernel of each slot, NULL if empty
+    UInt16 mix[CHAIN_SLOTS]; // Q15 level of the kernel output; the rest is the slot input
+    Bool fade; // Crossfade the slots that change, rather than switch at once
+} chain_config;
+
+// Empties every slot and clears their histories. An empty chain passes
+// its input through.
+void chain_init(void);
+
+// Returns the spare configuration, holding a copy of the published one.
+// Only the task that publishes may call this.
+chain_config *chain_edit(void);
+
+// Publishes the set from chain_edit(). fade selects a crossfade for the
+// slots whose kernel changed.
+void chain_publish(Bool fade);
+
+// Runs the current frame of audio_line (n samples, at audio_line.i)
+// through every non-empty slot in order and leaves the result in y.
+void chain_process(Int16 *y, UInt16 n);
+
+#endif /* EFFECT_CHAIN_H_ */
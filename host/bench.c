@@ -0,0 +1,1006 @@
+/*
+ * bench.c
+ *
+ * Per-effect throughput and worst-case benchmark. Every effect in
+ * sim_effects[] is run through the pedal's audio path for a sweep of knob
+ * positions and input signals. For each effect the suite reports mean and
+ * worst-case ns/sample and projects them onto the 4167-cycle budget set by
+ * the adc_a1_timer period in EffectsPedal.cfg.
+ *
+ * Usage: pedal_bench [-s target_cycles_per_host_ns] [-b baseline] [-w baseline] [-t tolerance]
+ *
+ * Host time is converted to cycles as ns * 0.2 (200 MHz) * scale, where
+ * scale is the measured target/host time ratio given with -s. Without -s
+ * the columns are host cycles ("host cyc", host ns at 200 MHz), which say
+ * nothing about the target: %budget is left out, target budgets such as
+ * REVERB_BUDGET are not checked, and the suite gates only on rel.
+ *
+ * audioOut_swi runs once per AUDIO_FRAME_LEN samples and has that many
+ * sample periods to finish, so the worst case is timed per frame and
+ * reported per sample. Each frame's time is the minimum over several runs of
+ * the same input, which filters out host scheduling noise while keeping
+ * data-dependent slow paths such as the wah table switch.
+ *
+ * Costs are also stored relative to a fixed reference workload (a 56-tap
+ * float dot product), timed next to every case, so a baseline written on one
+ * machine can be checked on another and frequency scaling cancels out.
+ * With -b the suite fails if any effect's relative mean cost exceeds its
+ * baseline by more than the tolerance (default 0.25).
+ *
+ * The cost of the delay-line index calculation is timed on its own: the
+ * compare-and-branch wrap of the original 9088-sample buffer against the
+ * mask of the power-of-two delay line, for one read per tap of a 56-tap
+ * window.
+ *
+ * The partitioned convolution behind effect_cab is timed for IRs of 1024,
+ * 2048 and 4096 taps in frames of 1 and of 16 samples, next to a
+ * direct-form float convolution of the same length. Each row gives the
+ * cost per sample, the share of the 4167-cycle budget in frames of 1
+ * (with -s) and the growth over 1024 taps. Only the long tail partitions
+ * grow with the IR (see partconv.h), so the suite fails if 4096 taps cost
+ * more than BENCH_CAB_GROWTH times 1024 at either frame length, or if the
+ * output in frames of 1 is not that in frames of 16, CONV_LATENCY(1)
+ * samples late.
+ *
+ * The FDN reverb reports the RAM its lines take and, with -s, fails the
+ * suite if its worst case exceeds REVERB_BUDGET cycles per sample. Its
+ * tail after half a second of noise must reach exactly 0 at the shortest
+ * and the longest decay, so rounding in the loop leaves no limit cycle.
+ *
+ * The echo is also checked for stability at its largest feedback gain,
+ * with and without damping: after a second of full-scale noise the input
+ * goes silent, and the peak of every following repeat must be no larger
+ * than the one before.
+ *
+ * The effect chain is checked against running its effects one after the
+ * other: noise through a chain of wah, chorus and echo must come out bit
+ * for bit the same as the wah's output run through the chorus alone and
+ * that through the echo. The cost of each slot is timed with chains of
+ * one to CHAIN_SLOTS passthrough slots. Switching a 1 kHz sine from the
+ * wah to the dry signal must, with the crossfade, step by no more than
+ * CHAIN_FADE_MAX_STEP times the sine's own largest step.
+ *
+ * The overrun counters in audio_stat must stay at zero over a clean
+ * run, and a kernel that takes 2*AUDIO_FRAME_LEN - 1 audio interrupts
+ * inside the Swi must be counted as one late Swi and one frame of
+ * dropped samples, and the trace ring must freeze on the late Swi.
+ *
+ * Every effect's input-to-output latency is measured with audio_lat, as
+ * on the target, and must equal the delay to the DAC peak of a real
+ * impulse at the simulated ADC in place of the marker.
+ *
+ * The thread profiler is run on the simulated CPU timer over two
+ * windows of the wah on noise. Its loads must add up to the whole
+ * window, and every thread must have run as often as its trigger fired.
+ *
+ * Effects that declare a reference in sim_effects[] (e.g. the Q15 wah
+ * against the float wah) are also run on the same sine and noise inputs
+ * as their reference, and the suite fails if the SNR of the DAC output
+ * against the reference drops below the stated minimum.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <partconv.h>
+#include <effect_chain.h>
+#include <thread_prof.h>
+#include <trace.h>
+#include "pedal_sim.h"
+
+#define BENCH_LEN 4800 // 100 ms of audio per case, a multiple of every frame length
+#define BENCH_FRAMES (BENCH_LEN / AUDIO_FRAME_LEN)
+#define BENCH_REPS 5 // Runs per case for the worst-case filter
+#define BENCH_MAX_EFFECTS 32
+#define BENCH_CAB_GROWTH 2.5 // Largest cab cost at 4096 taps over that at 1024
+
+typedef enum {
+    SIG_SILENCE,
+    SIG_SINE,
+    SIG_NOISE,
+    SIG_IMPULSE,
+    SIG_COUNT
+} bench_signal;
+
+static const char *signal_names[SIG_COUNT] = { "silence", "sine", "noise", "impulse" };
+static const UInt16 knobs[] = { 0, 1024, 2048, 3072, 4095 };
+#define NUM_KNOBS (sizeof(knobs) / sizeof(knobs[0]))
+
+typedef struct {
+    double mean_ns;
+    double worst_ns;
+    double rel_cost; // mean_ns / reference ns
+    const char *worst_signal;
+    UInt16 worst_knob;
+} bench_result;
+
+static UInt16 input[BENCH_LEN];
+static double frame_ns[BENCH_FRAMES];
+static double timer_overhead_ns;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void make_signal(bench_signal sig)
+{
+    UInt32 seed = 12345;
+    UInt16 i;
+
+    for(i = 0; i < BENCH_LEN; i++){
+        switch(sig){
+        case SIG_SINE:
+            input[i] = (UInt16)(32768 + 32767 * sin(2 * M_PI * 1000.0 * i / SIM_FS_HZ));
+            break;
+        case SIG_NOISE:
+            seed = seed * 1664525u + 1013904223u;
+            input[i] = (UInt16)(seed >> 16);
+            break;
+        case SIG_IMPULSE:
+            input[i] = (i % SIM_SAMPLES_PER_TICK == 0) ? 65535 : 32768;
+            break;
+        default:
+            input[i] = 32768;
+            break;
+        }
+    }
+}
+
+static void calibrate_timer(void)
+{
+    double best = 1e9;
+    int i;
+
+    for(i = 0; i < 10000; i++){
+        double t0 = now_ns();
+        double t1 = now_ns();
+        if(t1 - t0 < best) best = t1 - t0;
+    }
+    timer_overhead_ns = best;
+}
+
+/* ======== reference_ns ======== */
+// ns/sample of a fixed 56-tap float dot product over a circular buffer,
+// used to normalise costs between machines.
+static double reference_ns(void)
+{
+    static volatile float x[1024];
+    static const float c[56] = { 0.01f, -0.02f, 0.03f, 0.05f };
+    volatile float sink = 0;
+    double best = 1e30;
+    int r, i, n;
+
+    for(r = 0; r < BENCH_REPS; r++){
+        double t0 = now_ns();
+        for(i = 0; i < BENCH_LEN; i++){
+            float acc = 0;
+            x[i & 1023] = (float)i;
+            for(n = 0; n < 56; n++) acc += x[(i - n) & 1023] * c[n];
+            sink += acc;
+        }
+        double t = (now_ns() - t0) / BENCH_LEN;
+        if(t < best) best = t;
+    }
+    (void)sink;
+    return best;
+}
+
+/* ======== indexing_ns ======== */
+// ns/sample of 56 delayed reads per sample, with the index wrapped by
+// compare and branch (mask == 0, length 9088) or by masking (length 16384).
+static double indexing_ns(UInt16 mask)
+{
+    static volatile UInt16 x[9088 > buffer_length ? 9088 : buffer_length];
+    const UInt16 length = mask ? mask + 1 : 9088;
+    volatile UInt32 sink = 0;
+    double best = 1e30;
+    UInt16 w = 0;
+    int r, i, n;
+
+    for(r = 0; r < BENCH_REPS; r++){
+        double t0 = now_ns();
+        for(i = 0; i < BENCH_LEN; i++){
+            UInt32 acc = 0;
+            x[w] = (UInt16)i;
+            for(n = 0; n < 56; n++){
+                UInt16 j = (UInt16)(w - n);
+                if(mask) j &= mask;
+                else if(j >= length) j += length;
+                acc += x[j];
+            }
+            sink += acc;
+            if(++w >= length) w = 0;
+        }
+        double t = (now_ns() - t0) / BENCH_LEN;
+        if(t < best) best = t;
+    }
+    (void)sink;
+    return best;
+}
+
+/* ======== conv_run ======== */
+// Runs count samples of x through the convolution c in frames of n.
+static void conv_run(conv_part *c, Int16 *y, const Int16 *x, int count, UInt16 n)
+{
+    int i;
+
+    for(i = 0; i < count; i += n) conv_process(c, &y[i], &x[i], n);
+}
+
+/* ======== conv_ns ======== */
+// ns/sample of the partitioned convolution in frames of n samples
+// (direct == 0) or of a direct-form float convolution with a len-tap
+// IR. With check, the output in frames of 1 must be that in frames of
+// CONV_BLOCK, CONV_LATENCY(1) samples late; *ok is cleared if not.
+static double conv_ns(UInt16 len, int direct, UInt16 n, int *ok)
+{
+    static UInt32 mem[CONV_SEGS(CAB_MAX_TAPS)][DELAY_SEG_LEN / 2]; // 32-bit aligned segments
+    static UInt16 *seg[CONV_SEGS(CAB_MAX_TAPS)];
+    static Float ir[4096];
+    static Int16 x[4096 + BENCH_LEN];
+    static Int16 y[BENCH_LEN], y1[BENCH_LEN];
+    const int count = direct ? BENCH_LEN / 10 : BENCH_LEN;
+    volatile Float sink = 0;
+    conv_part c;
+    double best = 1e30;
+    UInt32 seed = 1;
+    int r, i, t;
+
+    for(i = 0; i < CONV_SEGS(CAB_MAX_TAPS); i++) seg[i] = (UInt16 *)mem[i];
+    for(i = 0; i < len; i++){
+        seed = seed * 1664525u + 1013904223u;
+        ir[i] = (Float)((Int32)(seed >> 16) - 32768) / 32768.0f * expf(-i / 400.0f) * 0.05f;
+    }
+    for(i = 0; i < 4096 + BENCH_LEN; i++){
+        seed = seed * 1664525u + 1013904223u;
+        x[i] = (Int16)(seed >> 16);
+    }
+    if(!direct && !conv_init(&c, seg, CONV_SEGS(CAB_MAX_TAPS), ir, len)) return 0;
+
+    if(!direct && ok){
+        conv_run(&c, y, &x[4096], count, CONV_BLOCK);
+        conv_reset(&c);
+        conv_run(&c, y1, &x[4096], count, 1);
+        conv_reset(&c);
+        for(i = 0; i + CONV_LATENCY(1) < count; i++)
+            if(y1[i + CONV_LATENCY(1)] != y[i]) *ok = 0;
+    }
+
+    for(r = 0; r < BENCH_REPS; r++){
+        double t0 = now_ns();
+        if(direct){
+            for(i = 0; i < count; i++){
+                const Int16 *w = &x[4096 + i];
+                Float acc = 0;
+                for(t = 0; t < len; t++) acc += (Float)*w-- * ir[t];
+                sink += acc;
+            }
+        }
+        else conv_run(&c, y, &x[4096], count, n);
+        double t = (now_ns() - t0) / count;
+        if(t < best) best = t;
+    }
+    (void)sink;
+    return best;
+}
+
+/* ======== chain_run ======== */
+// Runs len samples of in through the effect chain a frame at a time, as
+// audioOut_swi does but without the ADC and DAC conversions.
+static void chain_run(const Int16 *in, Int16 *out, UInt32 len)
+{
+    UInt32 i;
+    UInt16 k;
+
+    for(i = 0; i < len; i += AUDIO_FRAME_LEN){
+        Int16 *x = &audio_line.buf[audio_line.i];
+
+        for(k = 0; k < AUDIO_FRAME_LEN; k++) x[k] = in[i + k];
+        delay_mirror(&audio_line, AUDIO_FRAME_LEN);
+        chain_process(&out[i], AUDIO_FRAME_LEN);
+        delay_advance(&audio_line, AUDIO_FRAME_LEN);
+    }
+}
+
+/* ======== chain_slot ======== */
+// Puts fxn in slot s, as gpio_effect_task would
+static void chain_slot(UInt16 s, audio_effect_fxn fxn, Bool fade)
+{
+    chain_config *c = chain_edit();
+
+    c->fxn[s] = fxn;
+    c->mix[s] = CHAIN_WET;
+    chain_publish(fade);
+}
+
+/* ======== chain_exact ======== */
+// Returns the number of samples where the chain wah > chorus > echo
+// differs from the three effects run one after the other.
+#define CHAIN_TEST_LEN (4 * BENCH_LEN) // Long enough for the first echo
+#define CHAIN_FADE_MAX_STEP 1.5 // Equal-power sum of two in-phase signals is up to 1.41x
+static UInt32 chain_exact(void)
+{
+    static Int16 x[CHAIN_TEST_LEN], a[CHAIN_TEST_LEN], b[CHAIN_TEST_LEN];
+    static const audio_effect_fxn fx[3] = { effect_wah, effect_chorus, effect_echo };
+    UInt32 seed = 3, i, diff = 0;
+    UInt16 s;
+
+    for(i = 0; i < CHAIN_TEST_LEN; i++){
+        seed = seed * 1664525u + 1013904223u;
+        x[i] = (Int16)(seed >> 16) >> 1;
+    }
+
+    // One after the other, a in and b out
+    for(i = 0; i < CHAIN_TEST_LEN; i++) a[i] = x[i];
+    for(s = 0; s < 3; s++){
+        sim_reset(fx[s], 0);
+        chain_run(a, b, CHAIN_TEST_LEN);
+        for(i = 0; i < CHAIN_TEST_LEN; i++) a[i] = b[i];
+    }
+
+    // Chained, leaving slot 1 empty so the chorus reads a later slot's line
+    sim_reset(fx[0], 0);
+    chain_slot(2, fx[1], FALSE);
+    chain_slot(CHAIN_SLOTS - 1, fx[2], FALSE);
+    chain_run(x, b, CHAIN_TEST_LEN);
+    for(i = 0; i < CHAIN_TEST_LEN; i++) diff += (a[i] != b[i]);
+
+    sim_reset(effect_passthrough, 0);
+    return diff;
+}
+
+/* ======== switch_step ======== */
+// Largest step between neighbouring output samples around the point
+// where a 1 kHz sine switches from the wah to the dry signal, relative
+// to the largest step of the sine itself.
+static double switch_step(Bool fade)
+{
+    static Int16 x[CHAIN_TEST_LEN], y[CHAIN_TEST_LEN];
+    const UInt32 at = CHAIN_TEST_LEN / 2;
+    Int32 step = 0, sine_step = 0;
+    UInt32 i;
+
+    for(i = 0; i < CHAIN_TEST_LEN; i++)
+        x[i] = (Int16)(16384 * sin(2 * M_PI * 1000.0 * i / SIM_FS_HZ));
+    for(i = 1; i < CHAIN_TEST_LEN; i++){
+        if(abs(x[i] - x[i - 1]) > sine_step) sine_step = abs(x[i] - x[i - 1]);
+    }
+
+    sim_reset(effect_wah, 2048);
+    chain_run(x, y, at);
+    chain_slot(0, NULL, fade);
+    chain_run(&x[at], &y[at], CHAIN_TEST_LEN - at);
+
+    for(i = at - AUDIO_FRAME_LEN; i < at + CHAIN_FADE_LEN + AUDIO_FRAME_LEN; i++){
+        if(abs(y[i] - y[i - 1]) > step) step = abs(y[i] - y[i - 1]);
+    }
+
+    sim_reset(effect_passthrough, 0);
+    return (double)step / sine_step;
+}
+
+/* ======== chain_ns ======== */
+// ns/sample of a chain of slots passthrough slots over noise
+static double chain_ns(UInt16 slots)
+{
+    static Int16 x[BENCH_LEN], y[BENCH_LEN];
+    double best = 1e30;
+    UInt32 seed = 5;
+    int r, i;
+
+    for(i = 0; i < BENCH_LEN; i++){
+        seed = seed * 1664525u + 1013904223u;
+        x[i] = (Int16)(seed >> 16);
+    }
+
+    for(r = 0; r < BENCH_REPS; r++){
+        double t0;
+
+        sim_reset(effect_passthrough, 0);
+        for(i = 1; i < slots; i++) chain_slot(i, effect_passthrough, FALSE);
+        t0 = now_ns();
+        chain_run(x, y, BENCH_LEN);
+        t0 = (now_ns() - t0) / BENCH_LEN;
+        if(t0 < best) best = t0;
+    }
+
+    sim_reset(effect_passthrough, 0);
+    return best;
+}
+
+/* ======== stall_fx ======== */
+// Passthrough that takes stall_len audio interrupts on its first call,
+// as if the Swi were preempted for that long
+static UInt16 stall_len;
+static void stall_fx(Int16 *y, Int16 *x, UInt16 n)
+{
+    UInt16 k;
+
+    for(; stall_len > 0; stall_len--) sim_interrupt(0x8000);
+    for(k = 0; k < n; k++) y[k] = x[k];
+}
+
+/* ======== trace_frozen ======== */
+// Returns 1 if the trace ring is freezing, or has frozen, with the late
+// Swi (which comes before the drop it causes) TRACE_FREEZE records from
+// the end
+static int trace_frozen(void)
+{
+#if TRACE_ENABLE && TRACE_FREEZE
+    UInt16 after = TRACE_FREEZE - trace.stop; // Records since the late Swi
+    UInt16 slot = (trace.next + 2 * TRACE_LEN - 1 - after) % TRACE_LEN;
+
+    return trace.stop != TRACE_RUN && trace.rec[slot].id == TRACE_LATE &&
+           trace.rec[slot].seq == (UInt16)(trace.count - 1 - after);
+#else
+    return 1;
+#endif
+}
+
+/* ======== overrun_check ======== */
+// Runs the audio path clean and then with one stalled Swi. Returns 1 if
+// audio_stat counted exactly what happened and the trace ring froze on
+// the glitch.
+static int overrun_check(audio_stats *clean, audio_stats *stalled)
+{
+    UInt32 i;
+    int frozen;
+
+    sim_reset(effect_passthrough, 0);
+    for(i = 0; i < BENCH_LEN; i++) sim_sample(0x8000);
+    *clean = audio_stat;
+
+    sim_reset(stall_fx, 0);
+    stall_len = 0;
+    for(i = 0; i < BENCH_LEN; i++){
+        if(i == BENCH_LEN / 2) stall_len = 2 * AUDIO_FRAME_LEN - 1;
+        sim_sample(0x8000);
+    }
+    *stalled = audio_stat;
+    frozen = trace_frozen();
+
+    sim_reset(effect_passthrough, 0);
+    return frozen && clean->dropped == 0 && clean->late == 0 && clean->max_backlog == AUDIO_FRAME_LEN &&
+           stalled->dropped == AUDIO_FRAME_LEN && stalled->late == 1 &&
+           stalled->max_backlog == 2 * AUDIO_FRAME_LEN;
+}
+
+/* ======== latency_check ======== */
+// Measures an effect's latency with audio_lat and, from the same start,
+// with a real impulse at the simulated ADC in place of the marker.
+// Returns the samples audio_lat counted and leaves the impulse's in
+// *impulse, or returns -1 if the measurement did not finish.
+#define LAT_START (64 * AUDIO_FRAME_LEN) // Samples of silence before the marker
+static long latency_check(const sim_effect *fx, long *impulse)
+{
+    UInt32 i, at, peak = 0;
+    long samples;
+
+    *impulse = -1;
+    sim_reset(fx->fxn, 2048);
+    for(i = 0; i < LAT_START - 1; i++) sim_sample(0x8000);
+    audio_latArm(); // The Swi after the next sample takes the marker
+    for(; i < LAT_START + AUDIO_LAT_WINDOW + 4 * AUDIO_FRAME_LEN && audio_lat.runs == 0; i++)
+        sim_sample(0x8000);
+    if(audio_lat.runs == 0) return -1;
+    at = audio_lat.at;
+    samples = audio_lat.samples;
+
+    // The marker is Q15, the ADC code offset binary before the DC blocker
+    sim_reset(fx->fxn, 2048);
+    for(i = 0; i < at + AUDIO_LAT_WINDOW; i++){
+        UInt16 dac = sim_sample(i == at ? 0x8000 + AUDIO_LAT_MARKER : 0x8000);
+        UInt16 d = (dac >= 2048) ? dac - 2048 : 2048 - dac;
+
+        if(i >= at && d > peak){
+            peak = d;
+            *impulse = i - at;
+        }
+    }
+
+    sim_reset(effect_passthrough, 0);
+    return samples;
+}
+
+/* ======== prof_check ======== */
+// Runs the wah over two profiling windows of noise on host time.
+// Returns 1 if prof_stat accounts for the whole window and for every
+// run of the audio threads, the tick and the knob Hwi.
+#define PROF_LEN ((UInt32)PROF_WINDOW_TICKS * SIM_SAMPLES_PER_TICK)
+static int prof_check(prof_stats *st)
+{
+    const UInt32 frames = PROF_LEN / AUDIO_FRAME_LEN;
+    UInt32 seed = 7, i, total = 0;
+    UInt16 t;
+    int ok;
+
+    sim_time.clock = now_ns;
+    sim_reset(effect_wah, 2048);
+    for(i = 0; i < 2 * PROF_LEN + SIM_SAMPLES_PER_TICK / 2; i++){
+        seed = seed * 1664525u + 1013904223u;
+        sim_sample((UInt16)(seed >> 16));
+    }
+    sim_time.clock = NULL;
+    *st = prof_stat;
+
+    for(t = 0; t < PROF_THREADS; t++) total += st->thread[t].load;
+    ok = st->windows == 2 && total >= 10000 - PROF_THREADS && total <= 10000 &&
+         st->thread[PROF_TICK].runs == PROF_WINDOW_TICKS &&
+         st->thread[PROF_KNOB].runs == PROF_WINDOW_TICKS &&
+         st->thread[PROF_AUDIO_OUT].runs == frames;
+#if AUDIO_USE_DMA
+    ok = ok && st->thread[PROF_AUDIO_DMA].runs == frames;
+#else
+    ok = ok && st->thread[PROF_AUDIO_IN].runs == PROF_LEN;
+#endif
+
+    sim_reset(effect_passthrough, 0);
+    return ok || !PROF_ENABLE;
+}
+
+/* ======== reverb_tail ======== */
+// Feeds the reverb half a second of noise at the given knob, then
+// silence, and returns the time in s of the last output sample that is
+// not exactly 0, or -1 if the output is still not silent after
+// REVERB_TAIL_LEN samples.
+#define REVERB_TAIL_LEN (30 * 48000L)
+static double reverb_tail(UInt16 knob)
+{
+    static Int16 x[AUDIO_FRAME_LEN], y[AUDIO_FRAME_LEN];
+    UInt32 seed = 11, i, last = 0;
+    UInt16 k;
+
+    sim_reset(effect_reverb, knob);
+    for(i = 0; i < REVERB_TAIL_LEN; i += AUDIO_FRAME_LEN){
+        for(k = 0; k < AUDIO_FRAME_LEN; k++){
+            seed = seed * 1664525u + 1013904223u;
+            x[k] = (i < 24000) ? (Int16)(seed >> 16) >> 1 : 0;
+        }
+        effect_reverb(y, x, AUDIO_FRAME_LEN);
+        for(k = 0; k < AUDIO_FRAME_LEN; k++){
+            if(y[k] != 0) last = i + k;
+        }
+    }
+
+    sim_reset(effect_passthrough, 0);
+    return last + 48000 > REVERB_TAIL_LEN ? -1 : (double)last / SIM_FS_HZ;
+}
+
+/* ======== echo_stable ======== */
+// Runs effect_echo with feedback gain 32767 and the given damping over
+// noise and then silence. Returns 1 if every repeat in the silence is at
+// most as loud as the one before; the peaks of the first and last repeat
+// are returned in dBFS.
+#define ECHO_REPEATS 20
+static int echo_stable(UInt16 damp, double *first_db, double *last_db)
+{
+    static Int16 x[AUDIO_FRAME_LEN], y[AUDIO_FRAME_LEN];
+    audio_params p;
+    UInt32 seed = 7, period, i;
+    Int32 peak = 0, last_peak = 32768;
+    int ok = 1, repeat = 0;
+    UInt16 k;
+
+    sim_reset(effect_echo, 0);
+    p = *audio_param;
+    p.echo_gain = 32767;
+    p.echo_damp = damp;
+    audio_param = &p;
+
+    period = p.echo_delay[ECHO_TAPS - 1];
+    period -= period % AUDIO_FRAME_LEN;
+
+    for(i = 0; i < 48000 + ECHO_REPEATS * period; i += AUDIO_FRAME_LEN){
+        for(k = 0; k < AUDIO_FRAME_LEN; k++){
+            seed = seed * 1664525u + 1013904223u;
+            x[k] = (i < 48000) ? (Int16)(seed >> 16) : 0;
+        }
+        effect_echo(y, x, AUDIO_FRAME_LEN);
+        if(i < 48000) continue;
+
+        for(k = 0; k < AUDIO_FRAME_LEN; k++){
+            Int32 v = abs(y[k]);
+            if(v > peak) peak = v;
+        }
+
+        // Close one repeat every period samples of silence
+        if((i - 48000 + AUDIO_FRAME_LEN) % period == 0){
+            if(peak > last_peak) ok = 0;
+            if(repeat == 0) *first_db = 20 * log10((peak + 1e-9) / 32768.0);
+            *last_db = 20 * log10((peak + 1e-9) / 32768.0);
+            last_peak = peak;
+            peak = 0;
+            repeat++;
+        }
+    }
+
+    sim_reset(effect_passthrough, 0);
+    return ok;
+}
+
+static void run_effect(const sim_effect *fx, bench_result *res)
+{
+    double total_ns = 0, total_ref_ns = 0;
+    UInt32 total_samples = 0;
+    int sig, k, r, i;
+
+    memset(res, 0, sizeof(*res));
+
+    for(sig = 0; sig < SIG_COUNT; sig++){
+        make_signal((bench_signal)sig);
+
+        for(k = 0; k < (int)NUM_KNOBS; k++){
+            double best_bulk = 1e30;
+
+            for(i = 0; i < BENCH_FRAMES; i++) frame_ns[i] = 1e30;
+
+            // Bulk timing for the mean
+            for(r = 0; r < BENCH_REPS; r++){
+                double t0;
+                sim_reset(fx->fxn, knobs[k]);
+                t0 = now_ns();
+                for(i = 0; i < BENCH_LEN; i++) sim_sample(input[i]);
+                t0 = now_ns() - t0;
+                if(t0 < best_bulk) best_bulk = t0;
+            }
+            total_ns += best_bulk;
+            total_ref_ns += reference_ns() * BENCH_LEN;
+            total_samples += BENCH_LEN;
+
+            // Per-frame timing for the worst case
+            for(r = 0; r < BENCH_REPS; r++){
+                sim_reset(fx->fxn, knobs[k]);
+                for(i = 0; i < BENCH_FRAMES; i++){
+                    const UInt16 *frame = &input[i * AUDIO_FRAME_LEN];
+                    double t0 = now_ns();
+                    int j;
+                    for(j = 0; j < AUDIO_FRAME_LEN; j++) sim_sample(frame[j]);
+                    t0 = now_ns() - t0 - timer_overhead_ns;
+                    if(t0 < frame_ns[i]) frame_ns[i] = t0;
+                }
+            }
+            for(i = 0; i < BENCH_FRAMES; i++){
+                double ns = frame_ns[i] / AUDIO_FRAME_LEN;
+                if(ns > res->worst_ns){
+                    res->worst_ns = ns;
+                    res->worst_signal = signal_names[sig];
+                    res->worst_knob = knobs[k];
+                }
+            }
+        }
+    }
+
+    res->mean_ns = total_ns / total_samples;
+    res->rel_cost = total_ns / total_ref_ns;
+}
+
+/* ======== accuracy_snr ======== */
+// Worst SNR in dB of an effect's DAC output against its reference's
+// over the sine and noise inputs and every knob position.
+static double accuracy_snr(const sim_effect *fx, const sim_effect *ref)
+{
+    static UInt16 ref_out[BENCH_LEN];
+    double worst = 1e9;
+    int sig, k, i;
+
+    for(sig = SIG_SINE; sig <= SIG_NOISE; sig++){
+        make_signal((bench_signal)sig);
+
+        for(k = 0; k < (int)NUM_KNOBS; k++){
+            double sig_pow = 0, err_pow = 0, snr;
+
+            sim_reset(ref->fxn, knobs[k]);
+            for(i = 0; i < BENCH_LEN; i++) ref_out[i] = sim_sample(input[i]);
+
+            sim_reset(fx->fxn, knobs[k]);
+            for(i = 0; i < BENCH_LEN; i++){
+                double r = ref_out[i] - 2048.0;
+                double e = (double)sim_sample(input[i]) - ref_out[i];
+                sig_pow += r * r;
+                err_pow += e * e;
+            }
+
+            snr = (err_pow > 0) ? 10 * log10(sig_pow / err_pow) : 200.0;
+            if(snr < worst) worst = snr;
+        }
+    }
+    return worst;
+}
+
+static int load_baseline(const char *path, const char *name, double *rel)
+{
+    FILE *f = fopen(path, "r");
+    char line[256], fx[64];
+    double v;
+
+    if(!f) return -1;
+    while(fgets(line, sizeof(line), f)){
+        if(line[0] == '#') continue;
+        if(sscanf(line, "%63s %lf", fx, &v) == 2 && !strcmp(fx, name)){
+            *rel = v;
+            fclose(f);
+            return 0;
+        }
+    }
+    fclose(f);
+    return -1;
+}
+
+/* ======== bench_fail ======== */
+// Records a failed check, once per name, for the summary at the end
+#define BENCH_MAX_FAILS 16
+static const char *bench_fails[BENCH_MAX_FAILS];
+static int bench_numFails;
+static void bench_fail(const char *check)
+{
+    int i;
+
+    for(i = 0; i < bench_numFails; i++){
+        if(!strcmp(bench_fails[i], check)) return;
+    }
+    if(bench_numFails < BENCH_MAX_FAILS) bench_fails[bench_numFails++] = check;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: pedal_bench [-s scale] [-b baseline] [-w baseline] [-t tolerance]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *baseline = NULL, *write_baseline = NULL;
+    double scale = 1.0, tolerance = 0.25, ref;
+    bench_result results[BENCH_MAX_EFFECTS];
+    const char *cyc = "host cyc";
+    char mean_hdr[16], worst_hdr[16];
+    int i, target = 0;
+    UInt16 e;
+
+    for(i = 1; i < argc; i++){
+        if(i + 1 >= argc) usage();
+        if(!strcmp(argv[i], "-s")){
+            scale = atof(argv[++i]);
+            target = 1;
+            cyc = "cyc";
+        }
+        else if(!strcmp(argv[i], "-b")) baseline = argv[++i];
+        else if(!strcmp(argv[i], "-w")) write_baseline = argv[++i];
+        else if(!strcmp(argv[i], "-t")) tolerance = atof(argv[++i]);
+        else usage();
+    }
+
+    calibrate_timer();
+    ref = reference_ns();
+
+    if(target)
+        printf("budget: %d cycles/sample at %.0f Hz, frame %d samples, target/host time scale %.2f\n",
+               SIM_ADC_PERIOD, SIM_FS_HZ, AUDIO_FRAME_LEN, scale);
+    else
+        printf("budget: %d cycles/sample at %.0f Hz, frame %d samples; host cycles only, "
+               "-s scale for target cycles\n", SIM_ADC_PERIOD, SIM_FS_HZ, AUDIO_FRAME_LEN);
+    printf("reference 56-tap float FIR: %.1f ns/sample\n\n", ref);
+    snprintf(mean_hdr, sizeof(mean_hdr), "mean %s", cyc);
+    snprintf(worst_hdr, sizeof(worst_hdr), "worst %s", cyc);
+    printf("%-12s %10s %10s %14s %14s %8s %8s  %s\n", "effect", "mean ns", "worst ns",
+           mean_hdr, worst_hdr, "%budget", "rel", "worst case");
+
+    for(e = 0; e < sim_numEffects && e < BENCH_MAX_EFFECTS; e++){
+        bench_result *res = &results[e];
+        double mean_cyc, worst_cyc, base;
+
+        run_effect(&sim_effects[e], res);
+
+        mean_cyc = res->mean_ns * (SIM_CPU_HZ / 1e9) * scale;
+        worst_cyc = res->worst_ns * (SIM_CPU_HZ / 1e9) * scale;
+
+        printf("%-12s %10.1f %10.1f %14.0f %14.0f ", sim_effects[e].name, res->mean_ns,
+               res->worst_ns, mean_cyc, worst_cyc);
+        if(target) printf("%7.1f%%", 100.0 * worst_cyc / SIM_ADC_PERIOD);
+        else printf("%8s", "-");
+        printf(" %8.3f  %s, knob %u", res->rel_cost, res->worst_signal, res->worst_knob);
+
+        if(baseline && load_baseline(baseline, sim_effects[e].name, &base) == 0){
+            if(res->rel_cost > base * (1.0 + tolerance)){
+                printf("  SLOWER than baseline %.3f", base);
+                bench_fail("baseline");
+            }
+        }
+        printf("\n");
+    }
+
+    printf("\n%-30s %10s %10s\n", "delay indexing, 56 reads/sample", "ns", cyc);
+    for(i = 0; i < 2; i++){
+        double ns = indexing_ns(i ? buffer_length - 1 : 0);
+        char label[32];
+
+        if(i) snprintf(label, sizeof(label), "mask (%d)", buffer_length);
+        else snprintf(label, sizeof(label), "compare and branch (9088)");
+        printf("%-30s %10.1f %10.0f\n", label, ns, ns * (SIM_CPU_HZ / 1e9) * scale);
+    }
+
+    printf("\n%-30s %10s %10s %10s %8s %8s %8s %10s\n", "cab convolution, per sample", "ns n=1",
+           "ns n=16", cyc, "%budget", "x1024 1", "x1024 16", "direct");
+    {
+        double ns_1024[2] = { 0, 0 };
+        int same = 1;
+
+        for(i = 1024; i <= 4096; i <<= 1){
+            double ns[2], direct_ns = conv_ns(i, 1, 1, NULL);
+            double conv_cyc;
+            char label[32];
+
+            ns[0] = conv_ns(i, 0, 1, &same);
+            ns[1] = conv_ns(i, 0, CONV_BLOCK, NULL);
+            conv_cyc = ns[0] * (SIM_CPU_HZ / 1e9) * scale;
+            if(i == 1024){
+                ns_1024[0] = ns[0];
+                ns_1024[1] = ns[1];
+            }
+            snprintf(label, sizeof(label), "%d taps, %d+%d partitions", i,
+                     (i < CONV_HEAD_TAPS ? i : CONV_HEAD_TAPS) / CONV_BLOCK,
+                     i > CONV_HEAD_TAPS ? (i - CONV_HEAD_TAPS) / CONV_TAIL_BLOCK : 0);
+            printf("%-30s %10.1f %10.1f %10.0f ", label, ns[0], ns[1], conv_cyc);
+            if(target) printf("%7.1f%%", 100.0 * conv_cyc / SIM_ADC_PERIOD);
+            else printf("%8s", "-");
+            printf(" %8.2f %8.2f %10.0f\n", ns[0] / ns_1024[0], ns[1] / ns_1024[1],
+                   direct_ns * (SIM_CPU_HZ / 1e9) * scale);
+            if(ns[0] > BENCH_CAB_GROWTH * ns_1024[0] || ns[1] > BENCH_CAB_GROWTH * ns_1024[1]){
+                printf("  FAIL: more than %.1f times the cost of 1024 taps\n", BENCH_CAB_GROWTH);
+                bench_fail("cab scaling");
+            }
+        }
+        if(!same){
+            printf("  FAIL: frames of 1 differ from frames of %d delayed by %d\n", CONV_BLOCK,
+                   CONV_LATENCY(1));
+            bench_fail("cab frames");
+        }
+    }
+
+    for(e = 0; e < sim_numEffects && e < BENCH_MAX_EFFECTS; e++){
+        double worst_cyc;
+
+        if(sim_effects[e].fxn != effect_reverb) continue;
+        worst_cyc = results[e].worst_ns * (SIM_CPU_HZ / 1e9) * scale;
+        printf("\nreverb: %d lines, %d of %d words of D01SARAM, worst %.0f %s/sample, ",
+               REVERB_LINES, REVERB_LINE_WORDS, REVERB_MEM_LEN, worst_cyc, cyc);
+        if(!target){
+            printf("budget %d cyc not checked without -s\n", REVERB_BUDGET);
+            continue;
+        }
+        printf("budget %d%s\n", REVERB_BUDGET, worst_cyc > REVERB_BUDGET ? "  OVER BUDGET" : "");
+        if(worst_cyc > REVERB_BUDGET) bench_fail("reverb budget");
+    }
+
+    for(i = 0; i < 2; i++){
+        double t = reverb_tail(i ? 4095 : 0);
+
+        if(t < 0) printf("reverb tail at knob %d: not silent after %ld s  LIMIT CYCLE\n",
+                         i ? 4095 : 0, REVERB_TAIL_LEN / 48000);
+        else printf("reverb tail at knob %d: exactly 0 after %.2f s\n", i ? 4095 : 0, t);
+        if(t < 0) bench_fail("reverb tail");
+    }
+
+    printf("\n%-30s %10s %10s\n", "echo at feedback 1.0", "first dB", "last dB");
+    for(i = 0; i < 2; i++){
+        UInt16 damp = i ? ECHO_DAMP : 32767;
+        double first = 0, last = 0;
+        int ok = echo_stable(damp, &first, &last);
+        char label[32];
+
+        snprintf(label, sizeof(label), "damping %u, %d repeats", damp, ECHO_REPEATS);
+        printf("%-30s %10.1f %10.1f%s\n", label, first, last, ok ? "" : "  UNSTABLE");
+        if(!ok) bench_fail("echo stability");
+    }
+
+    printf("\n%-30s %10s %10s\n", "effect chain", "ns", cyc);
+    for(i = 1; i <= CHAIN_SLOTS; i++){
+        double ns = chain_ns(i);
+        char label[32];
+
+        snprintf(label, sizeof(label), "%d passthrough slot%s", i, i > 1 ? "s" : "");
+        printf("%-30s %10.1f %10.0f\n", label, ns, ns * (SIM_CPU_HZ / 1e9) * scale);
+    }
+#if CHAIN_SLOTS >= 3
+    {
+        UInt32 diff = chain_exact();
+
+        printf("wah > chorus > echo: %lu of %d samples differ from the effects run in turn%s\n",
+               (unsigned long)diff, CHAIN_TEST_LEN, diff ? "  MISMATCH" : "");
+        if(diff) bench_fail("chain exactness");
+    }
+#endif
+    {
+        double hard = switch_step(FALSE), fade = switch_step(TRUE);
+
+        printf("wah to dry on a 1 kHz sine: largest step %.2f x the sine's switched, "
+               "%.2f x crossfaded over %d samples%s\n", hard, fade, CHAIN_FADE_LEN,
+               fade > CHAIN_FADE_MAX_STEP ? "  GLITCH" : "");
+        if(fade > CHAIN_FADE_MAX_STEP) bench_fail("crossfade");
+    }
+
+    {
+        audio_stats clean, stalled;
+        int ok = overrun_check(&clean, &stalled);
+
+        printf("\n%-30s %10s %10s %10s\n", "audio_stat", "dropped", "late", "backlog");
+        printf("%-30s %10lu %10lu %10lu\n", "clean run", (unsigned long)clean.dropped,
+               (unsigned long)clean.late, (unsigned long)clean.max_backlog);
+        printf("%-30s %10lu %10lu %10lu%s\n", "Swi stalled 2 frames - 1", (unsigned long)stalled.dropped,
+               (unsigned long)stalled.late, (unsigned long)stalled.max_backlog, ok ? "" : "  MISCOUNTED");
+        if(!ok) bench_fail("overrun counters");
+    }
+
+    {
+        prof_stats st;
+        int ok = prof_check(&st);
+
+        printf("\n%-30s %10s %10s %10s %10s %8s\n", "thread profiler, wah", "runs", "min cyc",
+               "mean cyc", "max cyc", "load");
+        for(i = 0; i < PROF_THREADS; i++){
+            const prof_thread *th = &st.thread[i];
+
+            printf("%-30s %10lu %10lu %10lu %10lu %7.2f%%\n", prof_names[i], (unsigned long)th->runs,
+                   (unsigned long)th->min, (unsigned long)th->mean, (unsigned long)th->max,
+                   th->load / 100.0);
+        }
+        printf("window of %lu cycles%s\n", (unsigned long)st.window, ok ? "" : "  MISCOUNTED");
+        if(!ok) bench_fail("thread profiler");
+    }
+
+#if AUDIO_LAT_ENABLE
+    printf("\n%-30s %10s %10s %10s\n", "latency, marker to DAC peak", "samples", "us", "impulse");
+    for(e = 0; e < sim_numEffects; e++){
+        long impulse, samples = latency_check(&sim_effects[e], &impulse);
+
+        printf("%-30s %10ld %10.1f %10ld%s\n", sim_effects[e].name, samples,
+               samples * 1e6 / SIM_FS_HZ, impulse, samples >= 0 && samples == impulse ? "" : "  MISMATCH");
+        if(samples < 0 || samples != impulse) bench_fail("latency");
+    }
+#endif
+
+    printf("\n%-12s %-12s %10s %10s\n", "effect", "reference", "SNR dB", "min dB");
+    for(e = 0; e < sim_numEffects; e++){
+        const sim_effect *fx = &sim_effects[e];
+        const sim_effect *ref;
+        double snr;
+
+        if(!fx->reference) continue;
+        ref = sim_findEffect(fx->reference);
+        if(!ref){
+            printf("%-12s %-12s unknown reference\n", fx->name, fx->reference);
+            bench_fail("accuracy");
+            continue;
+        }
+
+        snr = accuracy_snr(fx, ref);
+        printf("%-12s %-12s %10.1f %10.1f%s\n", fx->name, ref->name, snr, fx->min_snr_db,
+               (snr < fx->min_snr_db) ? "  BELOW minimum" : "");
+        if(snr < fx->min_snr_db) bench_fail("accuracy");
+    }
+
+    if(write_baseline){
+        FILE *f = fopen(write_baseline, "w");
+        if(!f){
+            perror(write_baseline);
+            return 1;
+        }
+        fprintf(f, "# effect  mean cost relative to the reference 56-tap float FIR\n");
+        for(e = 0; e < sim_numEffects && e < BENCH_MAX_EFFECTS; e++){
+            fprintf(f, "%s %.3f\n", sim_effects[e].name, results[e].rel_cost);
+        }
+        fclose(f);
+    }
+
+    if(bench_numFails){
+        fprintf(stderr, "pedal_bench: failed:");
+        for(i = 0; i < bench_numFails; i++) fprintf(stderr, "%s %s", i ? "," : "", bench_fails[i]);
+        fprintf(stderr, "\n");
+    }
+    return bench_numFails > 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * dma_model.c
+ *
+ * Host model of the F2837xD DMA channels. See dma_model.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <Headers/F2837xD_device.h>
+#include "dma_model.h"
+
+#define DMASIM_MAX_REGIONS 16
+#define DMASIM_REGION_SHIFT 24
+
+typedef struct {
+    volatile Uint16 *base;
+    size_t words;
+} dmaSim_region;
+
+static dmaSim_region regions[DMASIM_MAX_REGIONS];
+static UInt16 numRegions;
+static void (*isrs[DMASIM_CHANNELS])(void);
+
+void dmaSim_reset(void)
+{
+    numRegions = 0;
+    for(UInt16 i = 0; i < DMASIM_CHANNELS; i++) isrs[i] = NULL;
+}
+
+void dmaSim_mapRegion(volatile void *base, size_t words)
+{
+    if(numRegions >= DMASIM_MAX_REGIONS){
+        fprintf(stderr, "dma_model: too many regions\n");
+        abort();
+    }
+    regions[numRegions].base = base;
+    regions[numRegions].words = words;
+    numRegions++;
+}
+
+Uint32 dmaSim_addr(volatile void *p)
+{
+    volatile Uint16 *w = p;
+
+    for(UInt16 i = 0; i < numRegions; i++){
+        if(w >= regions[i].base && w < regions[i].base + regions[i].words){
+            return ((Uint32)(i + 1) << DMASIM_REGION_SHIFT) | (Uint32)(w - regions[i].base);
+        }
+    }
+    fprintf(stderr, "dma_model: address %p is not in a mapped region\n", p);
+    abort();
+}
+
+static volatile Uint16 *dmaSim_ptr(Uint32 addr)
+{
+    Uint32 region = addr >> DMASIM_REGION_SHIFT;
+    Uint32 offset = addr & ((1ul << DMASIM_REGION_SHIFT) - 1);
+
+    if(region == 0 || region > numRegions || offset >= regions[region - 1].words){
+        fprintf(stderr, "dma_model: DMA access outside mapped memory (0x%08lx)\n",
+                (unsigned long)addr);
+        abort();
+    }
+    return regions[region - 1].base + offset;
+}
+
+static volatile struct CH_REGS *dmaSim_channel(UInt16 n)
+{
+    switch(n){
+    case 1: return &DmaRegs.CH1;
+    case 2: return &DmaRegs.CH2;
+    case 3: return &DmaRegs.CH3;
+    case 4: return &DmaRegs.CH4;
+    case 5: return &DmaRegs.CH5;
+    default: return &DmaRegs.CH6;
+    }
+}
+
+static UInt16 dmaSim_source(UInt16 n)
+{
+    switch(n){
+    case 1: return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1;
+    case 2: return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2;
+    case 3: return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3;
+    case 4: return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH4;
+    case 5: return DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5;
+    default: return DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6;
+    }
+}
+
+/* ======== dmaSim_burst ======== */
+// Services one trigger on a channel. Returns TRUE if the channel
+// raised its interrupt.
+static Bool dmaSim_burst(volatile struct CH_REGS *ch)
+{
+    Bool irq = FALSE;
+    UInt16 w;
+
+    // RUN and HALT are strobes
+    if(ch->CONTROL.bit.RUN){
+        ch->CONTROL.bit.RUN = 0;
+        ch->CONTROL.bit.RUNSTS = 1;
+    }
+    if(ch->CONTROL.bit.HALT){
+        ch->CONTROL.bit.HALT = 0;
+        ch->CONTROL.bit.RUNSTS = 0;
+    }
+    if(!ch->CONTROL.bit.RUNSTS || !ch->MODE.bit.PERINTE) return FALSE;
+
+    // Start of a transfer: reload the active registers from the shadows
+    if(!ch->CONTROL.bit.TRANSFERSTS){
+        ch->SRC_BEG_ADDR_ACTIVE = ch->SRC_BEG_ADDR_SHADOW;
+        ch->SRC_ADDR_ACTIVE = ch->SRC_ADDR_SHADOW;
+        ch->DST_BEG_ADDR_ACTIVE = ch->DST_BEG_ADDR_SHADOW;
+        ch->DST_ADDR_ACTIVE = ch->DST_ADDR_SHADOW;
+        ch->TRANSFER_COUNT = ch->TRANSFER_SIZE;
+        ch->CONTROL.bit.TRANSFERSTS = 1;
+        if(ch->MODE.bit.CHINTE && !ch->MODE.bit.CHINTMODE) irq = TRUE;
+    }
+
+    // One burst of BURSTSIZE + 1 words
+    for(w = 0; w <= ch->BURST_SIZE.bit.BURSTSIZE; w++){
+        *dmaSim_ptr(ch->DST_ADDR_ACTIVE) = *dmaSim_ptr(ch->SRC_ADDR_ACTIVE);
+        if(w < ch->BURST_SIZE.bit.BURSTSIZE){
+            ch->SRC_ADDR_ACTIVE += ch->SRC_BURST_STEP;
+            ch->DST_ADDR_ACTIVE += ch->DST_BURST_STEP;
+        }
+    }
+    ch->SRC_ADDR_ACTIVE += ch->SRC_TRANSFER_STEP;
+    ch->DST_ADDR_ACTIVE += ch->DST_TRANSFER_STEP;
+
+    // End of a transfer
+    if(ch->TRANSFER_COUNT == 0){
+        ch->CONTROL.bit.TRANSFERSTS = 0;
+        if(ch->MODE.bit.CHINTE && ch->MODE.bit.CHINTMODE) irq = TRUE;
+        if(!ch->MODE.bit.CONTINUOUS) ch->CONTROL.bit.RUNSTS = 0;
+    }
+    else{
+        ch->TRANSFER_COUNT--;
+    }
+
+    return irq;
+}
+
+void dmaSim_trigger(UInt16 source)
+{
+    Bool irq[DMASIM_CHANNELS] = { FALSE };
+    UInt16 n;
+
+    // All channels move their data before the CPU sees any interrupt
+    for(n = 1; n <= DMASIM_CHANNELS; n++){
+        if(dmaSim_source(n) == source) irq[n - 1] = dmaSim_burst(dmaSim_channel(n));
+    }
+    for(n = 0; n < DMASIM_CHANNELS; n++){
+        if(irq[n] && isrs[n]) isrs[n]();
+    }
+}
+
+void dmaSim_connect(UInt16 channel, void (*isr)(void))
+{
+    if(channel >= 1 && channel <= DMASIM_CHANNELS) isrs[channel - 1] = isr;
+}
@@ -0,0 +1,36 @@
+/*
+ * dma_model.h
+ *
+ * Host model of the F2837xD DMA channels, operating on the DmaRegs and
+ * DmaClaSrcSelRegs stand-ins. Each dmaSim_trigger() call is one peripheral
+ * trigger event: every running channel selected for that source moves one
+ * burst, reloading its active addresses from the shadow registers at the
+ * start of a transfer and raising its channel interrupt as configured by
+ * CHINTMODE. Address wrapping and one-shot mode are not modelled.
+ *
+ * DMA addresses are 32-bit handles into regions registered with
+ * dmaSim_mapRegion(); DMA_ADDR() in the pedal sources resolves to
+ * dmaSim_addr() on the host.
+ */
+
+#ifndef DMA_MODEL_H_
+#define DMA_MODEL_H_
+
+#include <stddef.h>
+#include <xdc/std.h>
+
+#define DMASIM_CHANNELS 6
+
+// Forget all regions and interrupt handlers
+void dmaSim_reset(void);
+
+// Make a block of 16-bit words addressable by the DMA
+void dmaSim_mapRegion(volatile void *base, size_t words);
+
+// Attach the handler run when a channel (1-6) raises its interrupt
+void dmaSim_connect(UInt16 channel, void (*isr)(void));
+
+// One trigger event from the given DMACHSRCSEL source
+void dmaSim_trigger(UInt16 source);
+
+#endif /* DMA_MODEL_H_ */
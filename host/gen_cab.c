@@ -0,0 +1,230 @@
+/*
+ * gen_cab.c
+ *
+ * Generates cab_ir.h and cab_ir.c, the cabinet impulse response applied
+ * by effect_cab.
+ *
+ * Usage: gen_cab [-n taps] [-i ir.wav] out.h out.c
+ *        (or 'make cab', which passes CAB_TAPS and CAB_IR through)
+ *
+ * The IR has -n taps (a power of two from 64 to 4096, default 2048) at
+ * 48 kHz. With -i it is the start of a measured IR from a 16-bit mono WAV
+ * file; otherwise it is a synthetic 4x12-style response: an impulse plus a
+ * short burst of decaying noise (cone breakup), through an 80 Hz highpass,
+ * a low resonance, a presence peak and a steep 5 kHz lowpass.
+ *
+ * Either way the tail is faded out over the last eighth of the taps and
+ * the IR is scaled so its largest gain over frequency is 0 dB, so the cab
+ * never boosts a full-scale input past the DAC.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wav.h"
+
+#define MAX_TAPS 4096 // CAB_MAX_TAPS in EffectsPedal_audio.h
+#define CAB_FS 48000.0
+
+typedef struct {
+    double b0, b1, b2, a1, a2;
+    double z1, z2;
+} biquad;
+
+static double ir[MAX_TAPS];
+static unsigned taps = 2048;
+
+/* ======== biquad_design ======== */
+// RBJ cookbook sections: 'h'ighpass, 'l'owpass or 'p'eaking (gain in dB).
+//
+static void biquad_design(biquad *f, char type, double fc, double q, double db)
+{
+    double w = 2*M_PI*fc/CAB_FS, cw = cos(w), alpha = sin(w)/(2*q);
+    double a = pow(10, db/40), a0;
+
+    switch(type){
+    case 'h':
+        f->b0 = (1 + cw)/2; f->b1 = -(1 + cw); f->b2 = (1 + cw)/2;
+        a0 = 1 + alpha; f->a1 = -2*cw; f->a2 = 1 - alpha;
+        break;
+    case 'l':
+        f->b0 = (1 - cw)/2; f->b1 = 1 - cw; f->b2 = (1 - cw)/2;
+        a0 = 1 + alpha; f->a1 = -2*cw; f->a2 = 1 - alpha;
+        break;
+    default:
+        f->b0 = 1 + alpha*a; f->b1 = -2*cw; f->b2 = 1 - alpha*a;
+        a0 = 1 + alpha/a; f->a1 = -2*cw; f->a2 = 1 - alpha/a;
+        break;
+    }
+    f->b0 /= a0; f->b1 /= a0; f->b2 /= a0; f->a1 /= a0; f->a2 /= a0;
+    f->z1 = f->z2 = 0;
+}
+
+static double biquad_run(biquad *f, double x)
+{
+    double y = f->b0*x + f->z1;
+
+    f->z1 = f->b1*x - f->a1*y + f->z2;
+    f->z2 = f->b2*x - f->a2*y;
+    return y;
+}
+
+/* ======== synth_ir ======== */
+static void synth_ir(void)
+{
+    biquad f[6];
+    unsigned n, s;
+    unsigned long seed = 12345;
+
+    biquad_design(&f[0], 'h', 80, 0.707, 0);
+    biquad_design(&f[1], 'p', 110, 1.4, 6);
+    biquad_design(&f[2], 'p', 2200, 1.0, 4);
+    biquad_design(&f[3], 'p', 3600, 2.0, -5);
+    biquad_design(&f[4], 'l', 5000, 0.707, 0);
+    biquad_design(&f[5], 'l', 5000, 0.707, 0);
+
+    for(n = 0; n < taps; n++){
+        double v, noise;
+
+        seed = seed * 1103515245 + 12345;
+        noise = (double)((seed >> 16) & 0x7FFF) / 16384.0 - 1.0;
+        v = (n == 0) + 0.25*noise*exp(-(double)n/(0.003*CAB_FS));
+
+        for(s = 0; s < 6; s++) v = biquad_run(&f[s], v);
+        ir[n] = v;
+    }
+}
+
+/* ======== load_ir ======== */
+static int load_ir(const char *path)
+{
+    wav_data w;
+    unsigned n;
+
+    if(wav_read(path, &w) != 0) return -1;
+    if(w.rate != (uint32_t)CAB_FS)
+        fprintf(stderr, "gen_cab: %s is %u Hz, the pedal runs at %.0f Hz\n",
+                path, (unsigned)w.rate, CAB_FS);
+
+    for(n = 0; n < taps; n++) ir[n] = n < w.length ? w.samples[n] / 32768.0 : 0;
+    wav_free(&w);
+    return 0;
+}
+
+/* ======== peak_gain ======== */
+// Largest magnitude of the IR's frequency response, on a 1 Hz grid
+// (direct DFT, only run once).
+//
+static double peak_gain(void)
+{
+    double peak = 0;
+    unsigned f, n;
+
+    for(f = 0; f <= CAB_FS/2; f += 1){
+        double w = 2*M_PI*f/CAB_FS, re = 0, im = 0, c = 1, s = 0;
+        double cw = cos(w), sw = sin(w);
+
+        // Rotate the phasor instead of calling cos/sin per tap
+        for(n = 0; n < taps; n++){
+            double t;
+
+            re += ir[n]*c;
+            im -= ir[n]*s;
+            t = c*cw - s*sw;
+            s = s*cw + c*sw;
+            c = t;
+        }
+        if(re*re + im*im > peak) peak = re*re + im*im;
+    }
+    return sqrt(peak);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: gen_cab [-n taps] [-i ir.wav] out.h out.c\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in = NULL, *out_h, *out_c;
+    unsigned n, fade;
+    double gain;
+    FILE *fh, *fc;
+    int i;
+
+    for(i = 1; i < argc - 2; i++){
+        if(i + 1 >= argc - 2) usage();
+        if(!strcmp(argv[i], "-n")) taps = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-i")) in = argv[++i];
+        else usage();
+    }
+    if(argc < 3) usage();
+    out_h = argv[argc - 2];
+    out_c = argv[argc - 1];
+
+    // conv_init() needs a power of two
+    if(taps < 64 || taps > MAX_TAPS || (taps & (taps - 1))){
+        fprintf(stderr, "gen_cab: taps must be a power of two from 64 to %d\n", MAX_TAPS);
+        return 1;
+    }
+
+    if(in){
+        if(load_ir(in) < 0){
+            fprintf(stderr, "gen_cab: cannot read %s\n", in);
+            return 1;
+        }
+    }
+    else synth_ir();
+
+    fade = taps/8;
+    for(n = 0; n < fade; n++) ir[taps - fade + n] *= 0.5 + 0.5*cos(M_PI*(n + 1)/fade);
+
+    gain = peak_gain();
+    if(gain <= 0){
+        fprintf(stderr, "gen_cab: impulse response is silent\n");
+        return 1;
+    }
+    for(n = 0; n < taps; n++) ir[n] /= gain;
+
+    fh = fopen(out_h, "w");
+    fc = fopen(out_c, "w");
+    if(!fh || !fc){
+        perror(!fh ? out_h : out_c);
+        return 1;
+    }
+
+    fprintf(fh, "/*\n"
+                " * cab_ir.h\n"
+                " *\n"
+                " * GENERATED by host/gen_cab - do not edit.\n"
+                " * %u taps at %.0f Hz, %s.\n"
+                " */\n\n"
+                "#ifndef CAB_IR_H_\n"
+                "#define CAB_IR_H_\n\n"
+                "#include <xdc/std.h>\n\n"
+                "// Length of the cabinet impulse response\n"
+                "#define CAB_IR_LEN %u\n\n"
+                "// Cabinet impulse response, peak gain 0 dB\n"
+                "extern const Float cab_ir[CAB_IR_LEN];\n\n"
+                "#endif /* CAB_IR_H_ */\n",
+            taps, CAB_FS, in ? "measured" : "synthetic 4x12", taps);
+
+    fprintf(fc, "/*\n"
+                " * cab_ir.c\n"
+                " *\n"
+                " * GENERATED by host/gen_cab - do not edit.\n"
+                " * Cabinet impulse response for effect_cab, kept in flash.\n"
+                " */\n\n"
+                "#include \"cab_ir.h\"\n\n"
+                "const Float cab_ir[CAB_IR_LEN] = {\n");
+    for(n = 0; n < taps; n++)
+        fprintf(fc, "%s%.9g%s", n % 6 == 0 ? "    " : "", ir[n],
+                n == taps - 1 ? "\n" : n % 6 == 5 ? ",\n" : ", ");
+    fprintf(fc, "};\n");
+
+    fclose(fh);
+    fclose(fc);
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ * gen_coeffs.c
+ *
+ * Designs the wah bandpass tables and generates bandpass_coeffs_gen.h and
+ * bandpass_coeffs_gen.c from them.
+ *
+ * Usage: gen_coeffs [-n taps] [-r rate] [-b bandwidth] [-f f1,f2,...]
+ *                   [-k sweep_tables] [-s svf_steps] out.h out.c
+ *        (or 'make coeffs', which passes WAH_TAPS, WAH_FS, WAH_BW,
+ *        WAH_FREQS, WAH_SWEEP and WAH_SVF_STEPS through)
+ *
+ * Each table is a Hamming-windowed FIR bandpass of the given number of taps
+ * (even, default 56), bandwidth -b Hz (default 1000) around one of the
+ * center frequencies -f, at sample rate -r (default 48000), scaled to unity
+ * gain at its center frequency. The first -k tables (default 11) are the
+ * ones effect_wah sweeps through; the defaults reproduce the tables that
+ * used to be hand-pasted into bandpass_coeffs.c.
+ *
+ * For every table the generator emits:
+ *  - h_x: the full float table, used by the host reference kernel.
+ *  - h_half_x: the first N/2 coefficients of the linear-phase table, for
+ *    the folded float FIR in effect_wah. The generator refuses tables that
+ *    are not symmetric (h[n] == h[N-1-n]).
+ *  - h_q15_x: the table rounded to Q15, saturated, and stored time-reversed
+ *    so effect_wahQ15 can walk the coefficients and the oldest-first sample
+ *    window in the same direction. The generator refuses tables whose sum of
+ *    |h| could overflow the kernel's 32-bit accumulator for full-scale input.
+ *
+ * It also emits h_half_all, every half table in order of center frequency
+ * for the coefficient-morphing wah, and wah_svf_g, the cutoff table of the
+ * state-variable wah, which sweeps the same range as effect_wah.
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TAPS 128
+#define MAX_TABLES 64
+#define MAX_SVF_STEPS 256
+
+typedef struct {
+    char name[32];
+    double fc;
+    double h[MAX_TAPS];
+} table;
+
+static table tables[MAX_TABLES];
+static unsigned num_tables;
+static unsigned taps = 56;
+static double rate = 48000.0;
+static double bandwidth = 1000.0;
+static unsigned sweep = 11;
+static unsigned svf_steps = 16;
+static double svf_g[MAX_SVF_STEPS + 1];
+
+static const char *default_freqs =
+    "1000,1500,2000,2500,3000,3500,4000,4500,5000,5500,6000,7000,8000,9000,10000";
+
+static int q15(double v)
+{
+    long q = lround(v * 32768.0);
+    if(q > 32767) q = 32767;
+    if(q < -32768) q = -32768;
+    return (int)q;
+}
+
+// Ideal lowpass impulse response with cutoff fc at t samples from the center
+static double lowpass(double fc, double t)
+{
+    double w = 2 * M_PI * fc / rate;
+    return (t == 0) ? w / M_PI : sin(w * t) / (M_PI * t);
+}
+
+// Hamming-windowed bandpass fc +/- bandwidth/2, unity gain at fc
+static void design(table *tb)
+{
+    double mid = (taps - 1) / 2.0;
+    double complex H = 0;
+    unsigned n;
+
+    for(n = 0; n < taps; n++){
+        double t = n - mid;
+        double w = 0.54 - 0.46 * cos(2 * M_PI * n / (taps - 1));
+
+        tb->h[n] = w * (lowpass(tb->fc + bandwidth / 2, t) - lowpass(tb->fc - bandwidth / 2, t));
+        H += tb->h[n] * cexp(-I * 2 * M_PI * tb->fc / rate * n);
+    }
+    for(n = 0; n < taps; n++) tb->h[n] /= cabs(H);
+}
+
+// "1k", "1k5", "2k25", "0k75", ...
+static void table_name(char *name, size_t len, double fc)
+{
+    long hz = lround(fc);
+    char frac[8];
+    int i;
+
+    snprintf(frac, sizeof(frac), "%03ld", hz % 1000);
+    for(i = 2; i >= 0 && frac[i] == '0'; i--) frac[i] = '\0';
+    snprintf(name, len, "%ldk%s", hz / 1000, frac);
+}
+
+static int parse_freqs(const char *list)
+{
+    char buf[1024], *tok;
+
+    strncpy(buf, list, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    num_tables = 0;
+
+    for(tok = strtok(buf, ","); tok; tok = strtok(NULL, ",")){
+        table *tb = &tables[num_tables];
+
+        if(num_tables >= MAX_TABLES) return -1;
+        tb->fc = atof(tok);
+        if(tb->fc - bandwidth / 2 <= 0 || tb->fc + bandwidth / 2 >= rate / 2) return -1;
+        if(num_tables > 0 && tb->fc <= tables[num_tables - 1].fc) return -1;
+        table_name(tb->name, sizeof(tb->name), tb->fc);
+        num_tables++;
+    }
+    return num_tables ? 0 : -1;
+}
+
+// Prints the coefficients of a float table, 6 per line
+static void print_float(FILE *f, const double *h, unsigned len, const char *fmt)
+{
+    unsigned n;
+
+    for(n = 0; n < len; n++){
+        fprintf(f, "%s", (n == 0) ? "\n" : (n % 6) ? "," : ",\n");
+        fprintf(f, fmt, h[n]);
+    }
+    fprintf(f, "\n};\n");
+}
+
+// Emits "const <type> *<prefix>; const <type> *<prefix>_arrays[] = {...};"
+// over the sweep tables, or "const <type> *<prefix>_all[] = {...};" over
+// every table
+static void print_arrays(FILE *f, const char *type, const char *prefix, int all)
+{
+    unsigned t, count = all ? num_tables : sweep;
+
+    if(all) fprintf(f, "\nconst %s *%s_all[] = {", type, prefix);
+    else fprintf(f, "\nconst %s *%s;\nconst %s *%s_arrays[] = {", type, prefix, type, prefix);
+    for(t = 0; t < count; t++) fprintf(f, "%s%s_%s", t ? ", " : "", prefix, tables[t].name);
+    fprintf(f, "};\n");
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: gen_coeffs [-n taps] [-r rate] [-b bandwidth] [-f f1,f2,...]\n"
+                    "                  [-k sweep_tables] [-s svf_steps] out.h out.c\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *freqs = default_freqs, *out_h, *out_c;
+    FILE *fh, *fc;
+    unsigned t, n;
+    int i;
+
+    for(i = 1; i < argc - 2; i++){
+        if(i + 1 >= argc - 2) usage();
+        if(!strcmp(argv[i], "-n")) taps = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-r")) rate = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-b")) bandwidth = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-f")) freqs = argv[++i];
+        else if(!strcmp(argv[i], "-k")) sweep = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-s")) svf_steps = atoi(argv[++i]);
+        else usage();
+    }
+    if(argc < 3) usage();
+    out_h = argv[argc - 2];
+    out_c = argv[argc - 1];
+
+    // The folded FIR and the C28x dual MAC both work on pairs of taps
+    if(taps < 2 || taps > MAX_TAPS || taps % 2){
+        fprintf(stderr, "gen_coeffs: taps must be even and at most %d\n", MAX_TAPS);
+        return 1;
+    }
+    if(parse_freqs(freqs) < 0){
+        fprintf(stderr, "gen_coeffs: center frequencies must be increasing and keep the "
+                        "band between 0 and rate/2\n");
+        return 1;
+    }
+    if(sweep < 2 || sweep > num_tables || svf_steps < 1 || svf_steps > MAX_SVF_STEPS){
+        fprintf(stderr, "gen_coeffs: need 2 to %u sweep tables and 1 to %d SVF steps\n",
+                num_tables, MAX_SVF_STEPS);
+        return 1;
+    }
+
+    for(t = 0; t < num_tables; t++){
+        const double *h = tables[t].h;
+        double sum = 0;
+
+        design(&tables[t]);
+
+        for(n = 0; n < taps/2; n++){
+            if(fabs(h[n] - h[taps - 1 - n]) > 1e-7){
+                fprintf(stderr, "gen_coeffs: h_%s is not symmetric at n = %u\n",
+                        tables[t].name, n);
+                return 1;
+            }
+        }
+
+        for(n = 0; n < taps; n++) sum += fabs(h[n]);
+        if(sum >= 2.0){
+            fprintf(stderr, "gen_coeffs: h_%s sum |h| = %.3f may overflow a 32-bit accumulator\n",
+                    tables[t].name, sum);
+            return 1;
+        }
+    }
+
+    fh = fopen(out_h, "w");
+    fc = fopen(out_c, "w");
+    if(!fh || !fc){
+        perror(!fh ? out_h : out_c);
+        return 1;
+    }
+
+    /* ---- Header ---- */
+    fprintf(fh, "/*\n"
+                " * bandpass_coeffs_gen.h\n"
+                " *\n"
+                " * GENERATED by host/gen_coeffs - do not edit.\n"
+                " * %u taps, %.0f Hz, %.0f Hz bandwidth, %u of %u tables in the sweep.\n"
+                " */\n\n"
+                "#ifndef BANDPASS_COEFFS_GEN_H_\n"
+                "#define BANDPASS_COEFFS_GEN_H_\n\n"
+                "// Define the window size used for each array\n"
+                "#define N %u\n\n"
+                "// Define the number of BPF arrays in the effect_wah sweep (h_arrays)\n"
+                "#define NUM_BPF %u\n\n"
+                "// Number of arrays in all, which the coefficient-morphing wah\n"
+                "// (effect_wahMorph) sweeps through\n"
+                "#define NUM_BPF_ALL %u\n\n"
+                "// Sample rate the arrays were designed for\n"
+                "#define WAH_FS %.1f\n\n"
+                "// The state-variable wah (effect_wahSvf) sweeps its center frequency\n"
+                "// continuously over the same range as h_arrays, from WAH_SVF_FMIN to\n"
+                "// WAH_SVF_FMAX in WAH_SVF_STEPS log-spaced steps\n"
+                "#define WAH_SVF_STEPS %u\n"
+                "#define WAH_SVF_FMIN %.1f\n"
+                "#define WAH_SVF_FMAX %.1f\n\n"
+                "// FIR coefficient arrays, each with a different bandpass center frequency\n",
+            taps, rate, bandwidth, sweep, num_tables, taps, sweep, num_tables, rate,
+            svf_steps, tables[0].fc, tables[sweep - 1].fc);
+    for(t = 0; t < num_tables; t++) fprintf(fh, "extern const Float h_%s[];\n", tables[t].name);
+    fprintf(fh, "\n#endif /* BANDPASS_COEFFS_GEN_H_ */\n");
+
+    /* ---- Tables ---- */
+    fprintf(fc, "/*\n"
+                " * bandpass_coeffs_gen.c\n"
+                " *\n"
+                " * GENERATED by host/gen_coeffs - do not edit.\n"
+                " *\n"
+                " * h_x: Hamming-windowed bandpass around x Hz, unity gain at x Hz.\n"
+                " * h_half_x: first N/2 coefficients of each symmetric table, for the\n"
+                " * folded FIR in effect_wah.\n"
+                " * h_q15_x: Q15 tables for effect_wahQ15, stored time-reversed\n"
+                " * (h_q15_x[n] = h_x[N-1-n]) and 32-bit aligned for the C28x dual MAC.\n"
+                " * h_half_all: every half table, for effect_wahMorph.\n"
+                " * wah_svf_g: SVF integrator gains for effect_wahSvf.\n"
+                " */\n\n"
+                "#include \"bandpass_coeffs.h\"\n");
+
+    for(t = 0; t < num_tables; t++){
+        fprintf(fc, "\nconst Float h_%s[N] = {", tables[t].name);
+        print_float(fc, tables[t].h, taps, "%.4E");
+    }
+
+    for(t = 0; t < num_tables; t++){
+        fprintf(fc, "\nconst Float h_half_%s[N/2] = {", tables[t].name);
+        print_float(fc, tables[t].h, taps/2, "%.4E");
+    }
+
+    for(t = 0; t < num_tables; t++){
+        fprintf(fc, "\n#pragma DATA_ALIGN(h_q15_%s, 2)\n", tables[t].name);
+        fprintf(fc, "const Int16 h_q15_%s[N] = {", tables[t].name);
+        for(n = 0; n < taps; n++){
+            fprintf(fc, "%s%d%s", (n % 8) ? " " : "\n", q15(tables[t].h[taps - 1 - n]),
+                    (n < taps - 1) ? "," : "");
+        }
+        fprintf(fc, "\n};\n");
+    }
+
+    fprintf(fc, "\nconst Float *h_arrays[] = {");
+    for(t = 0; t < sweep; t++) fprintf(fc, "%sh_%s", t ? ", " : "", tables[t].name);
+    fprintf(fc, "};\n");
+    print_arrays(fc, "Float", "h_half", 0);
+    print_arrays(fc, "Int16", "h_q15", 0);
+    print_arrays(fc, "Float", "h_half", 1);
+
+    fprintf(fc, "\nconst Float wah_svf_g[WAH_SVF_STEPS + 1] = {");
+    for(n = 0; n <= svf_steps; n++){
+        double f = tables[0].fc * pow(tables[sweep - 1].fc / tables[0].fc, (double)n / svf_steps);
+        svf_g[n] = tan(M_PI * f / rate);
+    }
+    print_float(fc, svf_g, svf_steps + 1, "%.6E");
+
+    fclose(fh);
+    fclose(fc);
+    return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * c28x_host.h
+ *
+ * Forced include (-include) for host builds of the pedal sources.
+ *
+ * The C28x has a 16-bit int, so the TI header types and the XDC types used
+ * by the audio path are mapped onto fixed-width host types here. That keeps
+ * the wraparound behaviour of the index arithmetic and the UInt16 sample
+ * math the same as on the F28379D. The TI-specific keywords used by the
+ * device headers are removed, and DMA addresses are routed through the
+ * host DMA model (dma_model.c), since host pointers do not fit in the
+ * 32-bit DMA address registers. The thread profiler reads the simulated
+ * CPU timer 2 of pedal_sim.c instead of the register.
+ */
+
+#ifndef C28X_HOST_H_
+#define C28X_HOST_H_
+
+#include <stdint.h>
+
+#define CPU1
+#define __interrupt
+#define EALLOW
+#define EDIS
+
+#define DSP28_DATA_TYPES
+typedef int16_t             int16;
+typedef int32_t             int32;
+typedef int64_t             int64;
+typedef uint16_t            Uint16;
+typedef uint32_t            Uint32;
+typedef uint64_t            Uint64;
+typedef float               float32;
+typedef double              float64;
+
+Uint32 dmaSim_addr(volatile void *p);
+#define DMA_ADDR(p) dmaSim_addr(p)
+
+Uint32 profSim_now(void);
+#define PROF_NOW() profSim_now()
+
+#endif /* C28X_HOST_H_ */
@@ -0,0 +1,16 @@
+/*
+ * ti/sysbios/hal/Hwi.h (host stand-in)
+ *
+ * The host simulator runs one thread at a time and only takes an
+ * interrupt when it is told to, so masking interrupts does nothing.
+ */
+
+#ifndef ti_sysbios_hal_Hwi__include
+#define ti_sysbios_hal_Hwi__include
+
+#include <xdc/std.h>
+
+static inline UInt Hwi_disable(void) { return 0; }
+static inline void Hwi_restore(UInt key) { (void)key; }
+
+#endif /* ti_sysbios_hal_Hwi__include */
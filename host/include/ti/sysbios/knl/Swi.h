@@ -0,0 +1,17 @@
+/*
+ * ti/sysbios/knl/Swi.h (host stand-in)
+ *
+ * Swi_post() is implemented by the host simulator (pedal_sim.c), which runs
+ * posted Swis after the Hwi that posted them returns, as SYS/BIOS would.
+ */
+
+#ifndef ti_sysbios_knl_Swi__include
+#define ti_sysbios_knl_Swi__include
+
+#include <xdc/std.h>
+
+typedef struct Swi_Object *Swi_Handle;
+
+void Swi_post(Swi_Handle swi);
+
+#endif /* ti_sysbios_knl_Swi__include */
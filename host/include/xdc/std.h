@@ -0,0 +1,46 @@
+/*
+ * xdc/std.h (host stand-in)
+ *
+ * Minimal subset of the XDC standard types for host builds. Int and UInt
+ * follow the C28x data model (16 bits) rather than the host's.
+ */
+
+#ifndef xdc_std__include
+#define xdc_std__include
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef char                Char;
+typedef unsigned char       UChar;
+typedef int16_t             Short;
+typedef uint16_t            UShort;
+typedef int16_t             Int;
+typedef uint16_t            UInt;
+typedef int32_t             Long;
+typedef uint32_t            ULong;
+typedef float               Float;
+typedef double              Double;
+typedef void                Void;
+typedef void               *Ptr;
+typedef const char         *CString;
+typedef uint16_t            Bool;
+typedef intptr_t            IArg;
+typedef uintptr_t           UArg;
+
+typedef int8_t              Int8;
+typedef uint8_t             UInt8;
+typedef int16_t             Int16;
+typedef uint16_t            UInt16;
+typedef int32_t             Int32;
+typedef uint32_t            UInt32;
+typedef int64_t             Int64;
+typedef uint64_t            UInt64;
+
+typedef uint16_t            Bits16;
+typedef uint32_t            Bits32;
+
+#define TRUE                1
+#define FALSE               0
+
+#endif /* xdc_std__include */
@@ -0,0 +1,201 @@
+/*
+ * pedal_sim.c
+ *
+ * Host-side model of the pedal's audio threads. See pedal_sim.h.
+ */
+
+#include <string.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <Headers/F2837xD_device.h>
+#include "dma_model.h"
+#include <effect_chain.h>
+#include <thread_prof.h>
+#include <trace.h>
+#include "pedal_sim.h"
+
+struct Swi_Object {
+    void (*fxn)(void);
+    Bool posted;
+};
+
+static struct Swi_Object audioOut_swi_obj = { audioOut_swi, FALSE };
+
+// Swi handle normally generated from EffectsPedal.cfg
+const Swi_Handle audioOut_swi_handle = &audioOut_swi_obj;
+
+const sim_effect sim_effects[] = {
+    { "passthrough", effect_passthrough },
+    { "wah_direct",  effect_wahDirect },
+    { "wah",         effect_wah, "wah_direct", 80.0 },
+    { "wah_q15",     effect_wahQ15, "wah", 55.0 },
+    { "wah_svf",     effect_wahSvf },
+    { "wah_morph",   effect_wahMorph },
+    { "echo",        effect_echo },
+    { "chorus",      effect_chorus },
+    { "bitcrush",    effect_bitCrush },
+    { "reverb",      effect_reverb },
+    { "cab_direct",  effect_cabDirect },
+    { "cab",         effect_cab, "cab_direct", 70.0 },
+};
+const UInt16 sim_numEffects = sizeof(sim_effects) / sizeof(sim_effects[0]);
+
+sim_timing sim_time;
+
+static UInt16 sim_knob;
+static UInt32 sim_sampleCount;
+static UInt16 sim_tickCount;
+
+/* ---- Simulated CPU timer 2 ---- */
+// Conversions start every SIM_ADC_PERIOD cycles. With sim_time.clock set
+// the timer also runs at SIM_CPU_HZ of host time while the threads run,
+// and whatever is left before the next conversion is idle time.
+static UInt64 sim_cycles; // Timer count at sim_clockMark
+static double sim_clockMark; // sim_time.clock() at sim_cycles
+
+Uint32 profSim_now(void)
+{
+    UInt64 t = sim_cycles;
+
+    if(sim_time.clock) t += (UInt64)((sim_time.clock() - sim_clockMark) * (SIM_CPU_HZ / 1e9));
+    CpuTimer2Regs.TIM.all = ~(Uint32)t; // Counts down
+    return ~CpuTimer2Regs.TIM.all;
+}
+
+/* ======== sim_timerSync ======== */
+// Moves the simulated timer on to the next conversion, unless the
+// threads have already run past it
+static void sim_timerSync(void)
+{
+    UInt64 now = sim_cycles, due = (UInt64)sim_sampleCount * SIM_ADC_PERIOD;
+    double mark = sim_time.clock ? sim_time.clock() : 0;
+
+    if(sim_time.clock) now += (UInt64)((mark - sim_clockMark) * (SIM_CPU_HZ / 1e9));
+    sim_cycles = (now > due) ? now : due;
+    sim_clockMark = mark;
+}
+
+const sim_effect *sim_findEffect(const char *name)
+{
+    UInt16 i;
+
+    for(i = 0; i < sim_numEffects; i++){
+        if(strcmp(sim_effects[i].name, name) == 0) return &sim_effects[i];
+    }
+    return NULL;
+}
+
+void Swi_post(Swi_Handle swi)
+{
+    // Posting an already pending Swi coalesces, as in SYS/BIOS
+    swi->posted = TRUE;
+}
+
+/* ======== sim_runSwis ======== */
+// Runs any Swi posted by the Hwi that just returned.
+static void sim_runSwis(void)
+{
+    if(audioOut_swi_obj.posted){
+        double t0 = sim_time.clock ? sim_time.clock() : 0;
+
+        audioOut_swi_obj.posted = FALSE;
+        audioOut_swi_obj.fxn();
+        if(sim_time.clock) sim_time.swi_ns = sim_time.clock() - t0;
+    }
+}
+
+/* ======== sim_tick ======== */
+// Replays the 100 Hz work: the wah stepping done by tickFxn and the
+// knob ADC conversion that CPU timer 0 starts at the same time, whose
+// Hwi comes after tickFxn as on the target.
+static void sim_tick(void)
+{
+    double t0;
+
+    prof_enter(PROF_TICK);
+    sim_tickCount++;
+    trace_log(TRACE_TICK, sim_tickCount, 0);
+    wahTickFlag = TRUE;
+    if(sim_tickCount % ((effectKnob_result>>8) + 1) == 0) wahFlag = TRUE;
+    prof_tick();
+    prof_exit(PROF_TICK);
+
+    t0 = sim_time.clock ? sim_time.clock() : 0;
+    AdccResultRegs.ADCRESULT0 = sim_knob;
+    effectIn1_hwi();
+    if(sim_time.clock) sim_time.knob_ns = sim_time.clock() - t0;
+}
+
+void sim_reset(audio_effect_fxn fxn, UInt16 knob)
+{
+    chain_config *c;
+    UInt16 i;
+
+    audio_init();
+    c = chain_edit();
+    c->fxn[0] = fxn;
+    chain_publish(FALSE);
+
+#if AUDIO_USE_DMA
+    // Regions the DMA channels move data between
+    dmaSim_reset();
+    dmaSim_mapRegion(audio_inFrame, 2 * AUDIO_FRAME_LEN);
+    dmaSim_mapRegion(audio_outFrame, 2 * AUDIO_FRAME_LEN);
+    dmaSim_mapRegion(&AdcdResultRegs, sizeof(AdcdResultRegs) / sizeof(Uint16));
+    dmaSim_mapRegion(&DacbRegs, sizeof(DacbRegs) / sizeof(Uint16));
+    dmaSim_connect(1, audioDma_hwi);
+    audio_dmaInit();
+#endif
+
+    // Start with the knob average already settled
+    for(i = 0; i < 10; i++) effectKnob_results[i] = knob;
+    effectKnob_result = knob;
+    audio_updateParams(knob);
+    sim_knob = knob;
+
+    audioOut_swi_obj.posted = FALSE;
+    sim_sampleCount = 0;
+    sim_tickCount = 0;
+
+    sim_cycles = 0;
+    sim_clockMark = sim_time.clock ? sim_time.clock() : 0;
+    prof_init();
+    trace_init();
+}
+
+void sim_setKnob(UInt16 knob)
+{
+    sim_knob = knob;
+}
+
+void sim_interrupt(UInt16 adc)
+{
+    AdcdResultRegs.ADCRESULT0 = adc;
+#if AUDIO_USE_DMA
+    dmaSim_trigger(DMA_ADCDINT1);
+#else
+    audioIn_hwi();
+#endif
+}
+
+UInt16 sim_sample(UInt16 adc)
+{
+    sim_time.swi_ns = sim_time.knob_ns = 0;
+    sim_timerSync();
+    sim_interrupt(adc);
+    sim_runSwis();
+
+    if(++sim_sampleCount % SIM_SAMPLES_PER_TICK == 0) sim_tick();
+
+    return DacbRegs.DACVALS.bit.DACVALS;
+}
+
+void sim_process(const Int16 *in, Int16 *out, size_t n)
+{
+    size_t i;
+
+    // 16-bit ADC codes are offset binary, the DAC takes the top 12 bits
+    for(i = 0; i < n; i++){
+        UInt16 dac = sim_sample((UInt16)(in[i] + 32768));
+        out[i] = (Int16)((Int32)(dac << 4) - 32768);
+    }
+}
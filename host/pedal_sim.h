@@ -0,0 +1,70 @@
+/*
+ * pedal_sim.h
+ *
+ * Host-side model of the pedal's audio threads. Each simulated ADC
+ * conversion loads AdcdResultRegs, runs audioIn_hwi (or, with
+ * AUDIO_USE_DMA, triggers the DMA model and its channel interrupt) and then
+ * any Swi that was posted, exactly as SYS/BIOS would on the F28379D, and
+ * returns the value left in DacbRegs. The 100 Hz timer0 tick (knob ADC + wah stepping) is
+ * replayed every SIM_SAMPLES_PER_TICK samples. CPU timer 2, which the thread
+ * profiler reads, is simulated: it jumps to each conversion time and runs
+ * on host time in between (see sim_timing).
+ */
+
+#ifndef PEDAL_SIM_H_
+#define PEDAL_SIM_H_
+
+#include <stddef.h>
+#include <xdc/std.h>
+#include <EffectsPedal_audio.h>
+
+#define SIM_CPU_HZ 200000000.0 // BIOS.cpuFreq in EffectsPedal.cfg
+#define SIM_ADC_PERIOD 4167 // adc_a1_timer period in CPU cycles
+#define SIM_FS_HZ (SIM_CPU_HZ / SIM_ADC_PERIOD) // ~47995 Hz
+#define SIM_SAMPLES_PER_TICK 480 // timer0 period of 10 ms in samples
+
+typedef struct {
+    const char *name;
+    audio_effect_fxn fxn;
+    const char *reference; // Effect this one must match, or NULL
+    double min_snr_db; // Minimum SNR of the output against the reference
+} sim_effect;
+
+// With clock set (a timestamp in ns), the simulation times the threads
+// whose cost depends on the effect and leaves the last durations here.
+// The simulated CPU timer 2 behind the thread profiler then also runs
+// on host time; without it every thread takes no time at all.
+typedef struct {
+    double (*clock)(void);
+    double swi_ns; // audioOut_swi run by the last sim_sample(), 0 if none
+    double knob_ns; // effectIn1_hwi run by the last sim_sample(), 0 if none
+} sim_timing;
+
+extern sim_timing sim_time;
+extern const sim_effect sim_effects[];
+extern const UInt16 sim_numEffects;
+
+const sim_effect *sim_findEffect(const char *name);
+
+// Host-only reference kernels (ref_effects.c)
+void effect_wahDirect(Int16 *y, Int16 *x, UInt16 n);
+void effect_cabDirect(Int16 *y, Int16 *x, UInt16 n);
+
+// Clear the audio state, put an effect alone in the first chain slot and
+// fix the knob position
+void sim_reset(audio_effect_fxn fxn, UInt16 knob);
+
+// Move the effect knob; the knob ADC Hwi averages it in over 10 ticks
+void sim_setKnob(UInt16 knob);
+
+// Load one ADC conversion and take its interrupt (audioIn_hwi or the DMA)
+// without running the Swis it posts, as if it preempted the running code
+void sim_interrupt(UInt16 adc);
+
+// Run one ADC conversion through the audio path and return the DAC code
+UInt16 sim_sample(UInt16 adc);
+
+// Run n signed 16-bit PCM samples through the audio path
+void sim_process(const Int16 *in, Int16 *out, size_t n);
+
+#endif /* PEDAL_SIM_H_ */
@@ -0,0 +1,73 @@
+/*
+ * ref_effects.c
+ *
+ * Host-only reference versions of effect kernels, kept to check that
+ * optimised kernels in EffectsPedal_audio.c still produce the same output.
+ */
+
+#include <bandpass_coeffs.h>
+#include <cab_ir.h>
+#include <partconv.h>
+#include "pedal_sim.h"
+
+// Direct convolution reads the whole IR from the input history, so
+// effect_cabDirect only works in the first slot of the chain (audio_line)
+#if CAB_IR_LEN + AUDIO_FRAME_LEN + CONV_LATENCY(AUDIO_FRAME_LEN) > buffer_length
+#error "buffer_length is too short for effect_cabDirect"
+#endif
+
+/* ======== effect_wahDirect ======== */
+// The unfolded N-tap float wah, using the full tables in h_arrays.
+// Follows the table effect_wah has selected.
+//
+void effect_wahDirect(Int16 *y, Int16 *x, UInt16 n)
+{
+    const Float *h = h_arrays[0];
+    UInt16 k, t;
+
+    // Let effect_wah's table stepping run, then find the matching full table
+    effect_wah(y, x, 0);
+    for(t = 0; t < NUM_BPF; t++){
+        if(h_half_arrays[t] == h_half) h = h_arrays[t];
+    }
+
+    for(k = 0; k < n; k++){
+        UInt16 i = audio_in->i + k;
+        Float acc = 0;
+
+        for(t = 0; t < N; t++){
+            UInt16 d = (UInt16)(i - t) & audio_in->mask;
+            acc += (Float)audio_in->buf[d] * h[t];
+        }
+
+        if(acc > 32767) acc = 32767;
+        else if(acc < -32768) acc = -32768;
+        y[k] = (Int16)acc;
+    }
+}
+
+/* ======== effect_cabDirect ======== */
+// Direct-form convolution with cab_ir in double precision, the
+// reference for the partitioned effect_cab. Delayed by the same
+// CONV_LATENCY as effect_cab at short frames.
+//
+void effect_cabDirect(Int16 *y, Int16 *x, UInt16 n)
+{
+    const Int16 *buf = audio_in->buf;
+    const UInt16 mask = audio_in->mask;
+    UInt16 k, t;
+
+    for(k = 0; k < n; k++){
+        UInt16 i = audio_in->i + k - CONV_LATENCY(AUDIO_FRAME_LEN);
+        double acc = 0;
+
+        for(t = 0; t < CAB_IR_LEN; t++){
+            UInt16 d = (UInt16)(i - t) & mask;
+            acc += (double)buf[d] * cab_ir[t];
+        }
+
+        if(acc > 32767) acc = 32767;
+        else if(acc < -32768) acc = -32768;
+        y[k] = (Int16)acc;
+    }
+}
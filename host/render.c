@@ -0,0 +1,135 @@
+/*
+ * render.c
+ *
+ * Offline renderer: streams WAV files through the pedal's audio path
+ * (EffectsPedal_audio.c compiled for the host) and reports how fast each
+ * effect runs compared to real time.
+ *
+ * Usage: pedal_render [-e effect|all] [-k knob] [-o outdir] [-T] in.wav ...
+ *
+ * Each input is written to <outdir>/<name>_<effect>.wav. Samples are
+ * processed at the file's own rate; the effect timings assume 48 kHz.
+ * With -T the trace ring left by each run is also saved, word for word
+ * as on the target, to <outdir>/<name>_<effect>.trace for pedal_trace.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <trace.h>
+#include "pedal_sim.h"
+#include "wav.h"
+
+// The host ring must have the target's layout for pedal_trace
+typedef char trace_layout[sizeof(trace_buf) == 2 * (TRACE_HDR_WORDS + TRACE_LEN * TRACE_REC_WORDS) ? 1 : -1];
+
+static int save_trace;
+
+static void usage(void)
+{
+    UInt16 i;
+
+    fprintf(stderr, "usage: pedal_render [-e effect|all] [-k knob 0-4095] [-o outdir] [-T] in.wav ...\n");
+    fprintf(stderr, "effects:");
+    for(i = 0; i < sim_numEffects; i++) fprintf(stderr, " %s", sim_effects[i].name);
+    fprintf(stderr, "\n");
+    exit(2);
+}
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int render(const wav_data *in, const sim_effect *fx, UInt16 knob,
+                  const char *outdir, const char *inpath)
+{
+    char path[4096];
+    const char *base = strrchr(inpath, '/');
+    const char *dot;
+    int16_t *out = malloc((in->length ? in->length : 1) * sizeof(int16_t));
+    double t0, t1;
+    int rc;
+
+    if(!out) return -1;
+    base = base ? base + 1 : inpath;
+    dot = strrchr(base, '.');
+
+    sim_reset(fx->fxn, knob);
+    t0 = now_sec();
+    sim_process(in->samples, out, in->length);
+    t1 = now_sec();
+
+    snprintf(path, sizeof(path), "%s/%.*s_%s.wav", outdir,
+             (int)(dot ? (size_t)(dot - base) : strlen(base)), base, fx->name);
+    rc = wav_write(path, out, in->length, in->rate);
+    free(out);
+
+    if(rc == 0 && save_trace){
+        FILE *f;
+
+        snprintf(path, sizeof(path), "%s/%.*s_%s.trace", outdir,
+                 (int)(dot ? (size_t)(dot - base) : strlen(base)), base, fx->name);
+        f = fopen(path, "wb");
+        if(!f || fwrite((const void *)&trace, sizeof(trace), 1, f) != 1){
+            perror(path);
+            rc = -1;
+        }
+        if(f) fclose(f);
+        snprintf(path, sizeof(path), "%s/%.*s_%s.wav", outdir,
+                 (int)(dot ? (size_t)(dot - base) : strlen(base)), base, fx->name);
+    }
+
+    if(rc == 0){
+        double rate = in->length / (t1 - t0);
+        printf("%-12s %-40s %10.0f samples/s %8.1fx real time\n",
+               fx->name, path, rate, rate / SIM_FS_HZ);
+    }
+    return rc;
+}
+
+int main(int argc, char **argv)
+{
+    const char *effect = "all";
+    const char *outdir = ".";
+    UInt16 knob = 2048;
+    int i, status = 0;
+
+    for(i = 1; i < argc && argv[i][0] == '-'; i++){
+        if(!strcmp(argv[i], "-T")){
+            save_trace = 1;
+            continue;
+        }
+        if(i + 1 >= argc) usage();
+        if(!strcmp(argv[i], "-e")) effect = argv[++i];
+        else if(!strcmp(argv[i], "-k")) knob = (UInt16)strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-o")) outdir = argv[++i];
+        else usage();
+    }
+    if(i >= argc || knob > 4095) usage();
+    if(strcmp(effect, "all") && !sim_findEffect(effect)) usage();
+
+    for(; i < argc; i++){
+        wav_data in;
+        UInt16 e;
+
+        if(wav_read(argv[i], &in) != 0){
+            status = 1;
+            continue;
+        }
+        if(in.rate < 47000 || in.rate > 49000){
+            fprintf(stderr, "%s: %u Hz input, effects are tuned for 48 kHz\n", argv[i], in.rate);
+        }
+
+        for(e = 0; e < sim_numEffects; e++){
+            if(strcmp(effect, "all") && strcmp(effect, sim_effects[e].name)) continue;
+            if(render(&in, &sim_effects[e], knob, outdir, argv[i]) != 0) status = 1;
+        }
+        wav_free(&in);
+    }
+
+    return status;
+}
@@ -0,0 +1,408 @@
+/*
+ * sched.c
+ *
+ * Discrete-event model of the pedal's SYS/BIOS threads, for deadline
+ * analysis of an effect chain before it is flashed.
+ *
+ * Usage: pedal_sched [-e effect[,effect...]] [-k knob] [-t seconds]
+ *                    [-s scale] [-c thread=cycles ...]
+ *
+ * The threads and their triggers follow EffectsPedal.cfg and
+ * EffectsPedal_main.c:
+ *
+ *   audioIn_hwi       ADCD INT1 (PIE 1.6), every adc_a1_timer period of
+ *                     4167 cycles; posts audioOut_swi every
+ *                     AUDIO_FRAME_LEN samples
+ *   audioDma_hwi      DMA CH1 (PIE 7.1), once per frame, instead of
+ *                     audioIn_hwi with AUDIO_USE_DMA
+ *   tickFxn           timer0 Hwi (PIE 1.7), every 10 ms; posts
+ *                     gpioTask_sem every 5th tick
+ *   effectIn1_hwi     knob ADC (ADCC INT2), KNOB_CONV cycles after each
+ *                     timer0 period starts its conversion
+ *   audioOut_swi      Swi priority 15
+ *   gpio_effect_task  Task, pends on gpioTask_sem
+ *   heartbeatIdleFxn  Idle, whatever time is left
+ *
+ * Hwis run to completion in PIE priority order (the BIOS dispatcher
+ * masks the lower groups and none of these nest), a Swi preempts the
+ * task, and any Hwi preempts both. As in SYS/BIOS, posting a Swi or
+ * semaphore or raising an interrupt that is already pending coalesces
+ * with it; each such lost release is counted.
+ *
+ * Costs are in target cycles. audioOut_swi and effectIn1_hwi are
+ * measured by running the chain through the host audio path over a
+ * second of noise (per frame and per tick, the minimum of three runs),
+ * converted with the same ns * 0.2 * scale as pedal_bench. The others
+ * are estimates of the target code plus the BIOS dispatch overhead.
+ * Any thread's cost can be replaced with a measured target figure using
+ * -c (e.g. -c audioOut_swi=5200).
+ *
+ * For each thread the report gives releases, lost releases, mean and
+ * worst cost, CPU utilisation, queueing delay (release to first
+ * instruction), worst response time and deadline misses. The deadline
+ * of audioOut_swi is the next frame boundary, when audioIn_hwi starts
+ * playing the half the Swi is writing; the Hwis must finish before
+ * their next interrupt and the task before its next post.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <effect_chain.h>
+#include "pedal_sim.h"
+
+#define SCHED_TIMER0_PERIOD 2000000.0 // 10 ms in cycles
+#define SCHED_TASK_TICKS 5 // tickFxn posts gpioTask_sem every 5th tick
+#define KNOB_CONV 250.0 // Knob ADC conversion after the timer0 trigger, cycles
+#define MEASURE_LEN 48000 // Samples of noise the costs are measured over
+#define MEASURE_REPS 3
+#define MAX_COSTS (MEASURE_LEN / AUDIO_FRAME_LEN)
+
+typedef enum { LEVEL_HWI, LEVEL_SWI, LEVEL_TASK } sched_level;
+
+typedef struct {
+    const char *name;
+    sched_level level;
+    double deadline; // Relative deadline in cycles
+    const char *source; // Where the cost comes from
+
+    // Cost model: the costs are used in turn
+    double *cost;
+    UInt32 num_costs, next_cost;
+
+    // State
+    Bool pending; // Released, not started
+    Bool running; // Started, not finished (may be preempted)
+    double remaining; // Cycles left of the running job
+    double release; // Release of the running job
+    double pend_release; // Release of the pending job
+    double start;
+
+    // Statistics
+    UInt32 releases, runs, lost, misses;
+    double busy, cost_sum, cost_max, wait_sum, wait_max, resp_max;
+} sched_thread;
+
+enum { T_AUDIO_IN, T_TICK, T_KNOB, T_SWI, T_TASK, T_COUNT };
+
+static double swi_costs[MAX_COSTS];
+static double knob_costs[MEASURE_LEN / SIM_SAMPLES_PER_TICK];
+static double est_audioIn = 120; // audioIn_hwi or audioDma_hwi, with the dispatcher
+static double est_tick = 150;
+static double est_task = 600; // Semaphore wake-up, GPIO reads and chain_publish()
+static double swi_overhead = 100; // Swi_post and Swi dispatch
+static double hwi_overhead = 80; // Hwi dispatcher entry and exit
+
+static sched_thread threads[T_COUNT] = {
+#if AUDIO_USE_DMA
+    { "audioDma_hwi",     LEVEL_HWI,  SIM_ADC_PERIOD * AUDIO_FRAME_LEN, "est." },
+#else
+    { "audioIn_hwi",      LEVEL_HWI,  SIM_ADC_PERIOD, "est." },
+#endif
+    { "tickFxn",          LEVEL_HWI,  SCHED_TIMER0_PERIOD, "est." },
+    { "effectIn1_hwi",    LEVEL_HWI,  SCHED_TIMER0_PERIOD, "host" },
+    { "audioOut_swi",     LEVEL_SWI,  SIM_ADC_PERIOD * AUDIO_FRAME_LEN, "host" },
+    { "gpio_effect_task", LEVEL_TASK, SCHED_TIMER0_PERIOD * SCHED_TASK_TICKS, "est." },
+};
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void usage(void)
+{
+    UInt16 i;
+
+    fprintf(stderr, "usage: pedal_sched [-e effect[,effect...]] [-k knob 0-4095] [-t seconds]\n"
+                    "                   [-s scale] [-c thread=cycles ...]\n");
+    fprintf(stderr, "effects:");
+    for(i = 0; i < sim_numEffects; i++) fprintf(stderr, " %s", sim_effects[i].name);
+    fprintf(stderr, "\nthreads:");
+    for(i = 0; i < T_COUNT; i++) fprintf(stderr, " %s", threads[i].name);
+    fprintf(stderr, "\n");
+    exit(2);
+}
+
+/* ======== set_chain ======== */
+// Resets the audio path with the comma-separated effects in the chain
+// slots, in order. Returns the number of effects or -1.
+static int set_chain(const char *list, UInt16 knob)
+{
+    char names[256], *name, *save;
+    chain_config *c;
+    int n = 0;
+
+    snprintf(names, sizeof(names), "%s", list);
+    sim_reset(effect_passthrough, knob);
+    c = chain_edit();
+    c->fxn[0] = NULL;
+
+    for(name = strtok_r(names, ",", &save); name; name = strtok_r(NULL, ",", &save)){
+        const sim_effect *fx = sim_findEffect(name);
+
+        if(!fx || n >= CHAIN_SLOTS){
+            fprintf(stderr, "pedal_sched: %s\n", fx ? "too many effects for CHAIN_SLOTS" : name);
+            return -1;
+        }
+        if(fx->fxn == effect_chorus && n != 0 && n != CHAIN_LONG_SLOT){
+            fprintf(stderr, "pedal_sched: chorus must be effect 1 or %d (the history of "
+                            "other slots is too short)\n", CHAIN_LONG_SLOT + 1);
+            return -1;
+        }
+        c->fxn[n] = fx->fxn;
+        c->mix[n] = CHAIN_WET;
+        n++;
+    }
+    chain_publish(FALSE);
+    return n;
+}
+
+/* ======== measure ======== */
+// Fills swi_costs and knob_costs with the host cost of each frame and
+// tick of the chain over noise, in target cycles.
+static void measure(const char *list, UInt16 knob, double scale)
+{
+    UInt32 seed = 12345, i, f, t;
+    int r;
+
+    for(f = 0; f < MAX_COSTS; f++) swi_costs[f] = 1e30;
+    for(t = 0; t < MEASURE_LEN / SIM_SAMPLES_PER_TICK; t++) knob_costs[t] = 1e30;
+
+    sim_time.clock = now_ns;
+    for(r = 0; r < MEASURE_REPS; r++){
+        set_chain(list, knob);
+        seed = 12345;
+        f = t = 0;
+        for(i = 0; i < MEASURE_LEN; i++){
+            seed = seed * 1664525u + 1013904223u;
+            sim_sample((UInt16)(seed >> 16));
+            if(sim_time.swi_ns > 0 && f < MAX_COSTS){
+                if(sim_time.swi_ns < swi_costs[f]) swi_costs[f] = sim_time.swi_ns;
+                f++;
+            }
+            if(sim_time.knob_ns > 0 && t < MEASURE_LEN / SIM_SAMPLES_PER_TICK){
+                if(sim_time.knob_ns < knob_costs[t]) knob_costs[t] = sim_time.knob_ns;
+                t++;
+            }
+        }
+    }
+    sim_time.clock = NULL;
+
+    for(i = 0; i < f; i++) swi_costs[i] = swi_costs[i] * (SIM_CPU_HZ / 1e9) * scale + swi_overhead;
+    for(i = 0; i < t; i++) knob_costs[i] = knob_costs[i] * (SIM_CPU_HZ / 1e9) * scale + hwi_overhead;
+    threads[T_SWI].cost = swi_costs;
+    threads[T_SWI].num_costs = f;
+    threads[T_KNOB].cost = knob_costs;
+    threads[T_KNOB].num_costs = t;
+}
+
+/* ======== release ======== */
+// Raises an interrupt, posts a Swi or posts a semaphore at time t
+static void release(sched_thread *th, double t)
+{
+    th->releases++;
+    if(th->pending){
+        th->lost++; // Coalesced with the one already waiting
+        return;
+    }
+    th->pending = TRUE;
+    th->pend_release = t;
+}
+
+/* ======== pick ======== */
+// Returns the thread that owns the CPU, or NULL for idle. A running Hwi
+// is never preempted; otherwise the first ready thread in table order
+// (Hwis by PIE priority, then the Swi, then the task) runs.
+static sched_thread *pick(double t)
+{
+    sched_thread *th;
+    UInt16 i;
+
+    for(i = 0; i < T_COUNT; i++){
+        if(threads[i].level == LEVEL_HWI && threads[i].running) return &threads[i];
+    }
+
+    for(i = 0; i < T_COUNT; i++){
+        th = &threads[i];
+        if(th->running) return th;
+        if(th->pending){
+            double wait = t - th->pend_release;
+
+            th->pending = FALSE;
+            th->running = TRUE;
+            th->release = th->pend_release;
+            th->start = t;
+            th->remaining = th->cost[th->next_cost];
+            th->next_cost = (th->next_cost + 1) % th->num_costs;
+            th->cost_sum += th->remaining;
+            if(th->remaining > th->cost_max) th->cost_max = th->remaining;
+            th->wait_sum += wait;
+            if(wait > th->wait_max) th->wait_max = wait;
+            th->runs++;
+            return th;
+        }
+    }
+    return NULL;
+}
+
+/* ======== complete ======== */
+static void complete(sched_thread *th, double t, UInt32 *samples, UInt32 *ticks)
+{
+    double resp = t - th->release;
+
+    th->running = FALSE;
+    if(resp > th->resp_max) th->resp_max = resp;
+    if(resp > th->deadline) th->misses++;
+
+    if(th == &threads[T_AUDIO_IN]){
+#if AUDIO_USE_DMA
+        release(&threads[T_SWI], t);
+#else
+        if(++*samples % AUDIO_FRAME_LEN == 0) release(&threads[T_SWI], t);
+#endif
+    }
+    else if(th == &threads[T_TICK]){
+        if(++*ticks % SCHED_TASK_TICKS == 0) release(&threads[T_TASK], t);
+    }
+}
+
+/* ======== simulate ======== */
+// Runs the model for the given number of cycles and returns the idle time
+static double simulate(double end)
+{
+    const double audio_period = SIM_ADC_PERIOD * (AUDIO_USE_DMA ? AUDIO_FRAME_LEN : 1);
+    double t = 0, idle = 0;
+    double next_audio = audio_period, next_tick = SCHED_TIMER0_PERIOD;
+    double next_knob = SCHED_TIMER0_PERIOD + KNOB_CONV;
+    UInt32 samples = 0, ticks = 0;
+
+    while(t < end){
+        sched_thread *th = pick(t);
+        double next = next_audio;
+
+        if(next_tick < next) next = next_tick;
+        if(next_knob < next) next = next_knob;
+        if(next > end) next = end;
+
+        if(th && t + th->remaining <= next){
+            t += th->remaining;
+            th->busy += th->remaining;
+            th->remaining = 0;
+            complete(th, t, &samples, &ticks);
+            continue;
+        }
+
+        if(th){
+            th->remaining -= next - t;
+            th->busy += next - t;
+        }
+        else idle += next - t;
+        t = next;
+
+        if(t >= next_audio){
+            release(&threads[T_AUDIO_IN], t);
+            next_audio += audio_period;
+        }
+        if(t >= next_tick){
+            release(&threads[T_TICK], t);
+            next_tick += SCHED_TIMER0_PERIOD;
+        }
+        if(t >= next_knob){
+            release(&threads[T_KNOB], t);
+            next_knob += SCHED_TIMER0_PERIOD;
+        }
+    }
+    return idle;
+}
+
+/* ======== set_cost ======== */
+// Applies one -c thread=cycles option
+static int set_cost(const char *arg)
+{
+    static double fixed[T_COUNT];
+    const char *eq = strchr(arg, '=');
+    UInt16 i;
+
+    if(!eq) return -1;
+    for(i = 0; i < T_COUNT; i++){
+        if(strlen(threads[i].name) == (size_t)(eq - arg) &&
+           strncmp(threads[i].name, arg, eq - arg) == 0){
+            fixed[i] = atof(eq + 1);
+            threads[i].cost = &fixed[i];
+            threads[i].num_costs = 1;
+            threads[i].source = "-c";
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *chain = "passthrough";
+    double seconds = 10, scale = 1, end, idle;
+    UInt16 knob = 2048;
+    const char *costs[T_COUNT * 2];
+    int num_costs = 0, i;
+
+    for(i = 1; i < argc; i++){
+        if(i + 1 >= argc) usage();
+        if(!strcmp(argv[i], "-e")) chain = argv[++i];
+        else if(!strcmp(argv[i], "-k")) knob = (UInt16)atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-t")) seconds = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-s")) scale = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-c") && num_costs < T_COUNT * 2) costs[num_costs++] = argv[++i];
+        else usage();
+    }
+    if(knob > 4095 || seconds <= 0 || scale <= 0) usage();
+    if(set_chain(chain, knob) < 0) usage();
+
+    threads[T_AUDIO_IN].cost = &est_audioIn;
+    threads[T_TICK].cost = &est_tick;
+    threads[T_TASK].cost = &est_task;
+    threads[T_AUDIO_IN].num_costs = threads[T_TICK].num_costs = threads[T_TASK].num_costs = 1;
+    measure(chain, knob, scale);
+
+    for(i = 0; i < num_costs; i++){
+        if(set_cost(costs[i]) < 0){
+            fprintf(stderr, "pedal_sched: bad cost %s\n", costs[i]);
+            usage();
+        }
+    }
+
+    end = seconds * SIM_CPU_HZ;
+    idle = simulate(end);
+
+    printf("chain %s, knob %u, frame %d samples, %.1f s at %.0f MHz, host scale %.2f\n\n",
+           chain, knob, AUDIO_FRAME_LEN, seconds, SIM_CPU_HZ / 1e6, scale);
+    printf("%-18s %-5s %9s %6s %9s %9s %7s %9s %9s %9s %9s %7s\n", "thread", "cost",
+           "releases", "lost", "mean cyc", "max cyc", "util %", "wait us", "max wait",
+           "max resp", "deadline", "misses");
+    for(i = 0; i < T_COUNT; i++){
+        const sched_thread *th = &threads[i];
+        const double us = 1e6 / SIM_CPU_HZ;
+
+        printf("%-18s %-5s %9u %6u %9.0f %9.0f %7.2f %9.2f %9.2f %9.2f %9.2f %7u\n",
+               th->name, th->source, (unsigned)th->releases, (unsigned)th->lost,
+               th->runs ? th->cost_sum / th->runs : 0, th->cost_max, 100 * th->busy / end,
+               th->runs ? th->wait_sum / th->runs * us : 0, th->wait_max * us,
+               th->resp_max * us, th->deadline * us, (unsigned)th->misses);
+    }
+    printf("%-18s %-5s %9s %6s %9s %9s %7.2f\n", "heartbeatIdleFxn", "", "", "", "", "",
+           100 * idle / end);
+
+    if(threads[T_SWI].misses || threads[T_SWI].lost)
+        printf("\naudioOut_swi missed %u of %u frames and lost %u posts\n",
+               (unsigned)threads[T_SWI].misses, (unsigned)threads[T_SWI].runs,
+               (unsigned)threads[T_SWI].lost);
+    else
+        printf("\naudioOut_swi met every deadline, worst response %.0f%% of the frame\n",
+               100 * threads[T_SWI].resp_max / threads[T_SWI].deadline);
+
+    return (threads[T_SWI].misses || threads[T_SWI].lost) ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * trace_dump.c
+ *
+ * Decoder for memory dumps of the trace ring (trace.h).
+ *
+ * Usage: pedal_trace [-n records] [-H] dump
+ *
+ * The dump is the TRACE_WORDS words of trace, saved by the CCS Memory
+ * Browser either as TI data (a "1651 ..." header line and one hex word per line)
+ * or as raw binary (little-endian 16-bit words), or the .trace file
+ * written by pedal_render -T. Records are put back in order from the
+ * header; records that were still being written when the memory was
+ * saved are dropped and counted.
+ *
+ * The timeline lists the last -n records (all by default, -n 0 for
+ * none; -H is the same as -n 0) with their time from the first record.
+ * It is followed by log2 histograms of the interval between successive
+ * records of each event and of these latencies:
+ *
+ *   FRAME > SWI_BEGIN     Swi dispatch: frame handed over to Swi start
+ *   SWI_BEGIN > SWI_END   Swi run time, including preemption
+ *   TICK > KNOB           knob ADC conversion and Hwi after the tick
+ *   PUBLISH > ADOPT       chain change: publish to first frame using it
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <trace.h>
+#include "pedal_sim.h"
+
+#define HIST_MIN_BITS 5 // First bucket: below 32 cycles (160 ns)
+#define HIST_BUCKETS 22 // Up to 2^26 cycles (336 ms), then overflow
+#define HIST_BAR 40
+
+typedef struct {
+    const char *name;
+    UInt32 count;
+    double sum, min, max;
+    UInt32 bucket[HIST_BUCKETS + 1];
+} histogram;
+
+typedef struct {
+    trace_event from, to;
+    histogram h;
+} latency;
+
+static const char *event_names[TRACE_EVENTS] = {
+    [TRACE_FRAME] = "FRAME",
+    [TRACE_SWI_BEGIN] = "SWI_BEGIN",
+    [TRACE_SWI_END] = "SWI_END",
+    [TRACE_DROP] = "DROP",
+    [TRACE_LATE] = "LATE",
+    [TRACE_TICK] = "TICK",
+    [TRACE_KNOB] = "KNOB",
+    [TRACE_PUBLISH] = "PUBLISH",
+    [TRACE_ADOPT] = "ADOPT",
+    [TRACE_LATENCY] = "LATENCY",
+};
+
+static latency latencies[] = {
+    { TRACE_FRAME, TRACE_SWI_BEGIN, { "FRAME > SWI_BEGIN" } },
+    { TRACE_SWI_BEGIN, TRACE_SWI_END, { "SWI_BEGIN > SWI_END" } },
+    { TRACE_TICK, TRACE_KNOB, { "TICK > KNOB" } },
+    { TRACE_PUBLISH, TRACE_ADOPT, { "PUBLISH > ADOPT" } },
+};
+#define NUM_LATENCIES (sizeof(latencies) / sizeof(latencies[0]))
+
+static UInt16 words[TRACE_WORDS];
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: pedal_trace [-n records] [-H] dump\n");
+    exit(2);
+}
+
+/* ======== load_dump ======== */
+// Reads up to TRACE_WORDS words of a TI data or raw binary dump.
+// Returns the number of words read, or -1.
+static long load_dump(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char line[128];
+    long n = 0;
+
+    if(!f){
+        perror(path);
+        return -1;
+    }
+
+    if(fgets(line, sizeof(line), f) && strncmp(line, "1651 ", 5) == 0){
+        while(n < TRACE_WORDS && fgets(line, sizeof(line), f))
+            words[n++] = (UInt16)strtoul(line, NULL, 16);
+    }
+    else{
+        unsigned char b[2];
+
+        rewind(f);
+        while(n < TRACE_WORDS && fread(b, 1, 2, f) == 2) words[n++] = b[0] | (b[1] << 8);
+    }
+
+    fclose(f);
+    return n;
+}
+
+static void hist_add(histogram *h, double cycles)
+{
+    UInt16 b = 0;
+
+    while(b < HIST_BUCKETS && cycles >= (double)(1UL << (b + HIST_MIN_BITS))) b++;
+    h->bucket[b]++;
+    if(h->count == 0 || cycles < h->min) h->min = cycles;
+    if(h->count == 0 || cycles > h->max) h->max = cycles;
+    h->sum += cycles;
+    h->count++;
+}
+
+static void hist_print(const histogram *h)
+{
+    const double us = 1e6 / SIM_CPU_HZ;
+    UInt32 most = 0;
+    UInt16 b, first = HIST_BUCKETS, last = 0;
+
+    if(h->count == 0) return;
+    for(b = 0; b <= HIST_BUCKETS; b++){
+        if(!h->bucket[b]) continue;
+        if(h->bucket[b] > most) most = h->bucket[b];
+        if(b < first) first = b;
+        last = b;
+    }
+
+    printf("\n%s: %lu, min %.2f us, mean %.2f us, max %.2f us\n", h->name,
+           (unsigned long)h->count, h->min * us, h->sum / h->count * us, h->max * us);
+    for(b = first; b <= last; b++){
+        int len = (int)((h->bucket[b] * (UInt64)HIST_BAR + most - 1) / most);
+        char label[32];
+
+        if(b == HIST_BUCKETS)
+            snprintf(label, sizeof(label), ">= %.1f us", (1UL << (b + HIST_MIN_BITS - 1)) * us * 2);
+        else
+            snprintf(label, sizeof(label), "< %.2f us", (1UL << (b + HIST_MIN_BITS)) * us);
+        printf("  %14s %8lu %.*s\n", label, (unsigned long)h->bucket[b], len,
+               "########################################");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static histogram periods[TRACE_EVENTS];
+    double last_time[TRACE_EVENTS], open_time[NUM_LATENCIES];
+    Bool seen[TRACE_EVENTS] = { 0 }, open[NUM_LATENCIES] = { 0 };
+    UInt32 count, kept, torn = 0, k;
+    UInt16 len, next, mask, stop, e, i;
+    long show = -1, n;
+    double t = 0, t_prev = 0;
+    UInt32 time_prev = 0;
+
+    for(i = 1; i < argc - 1; i++){
+        if(!strcmp(argv[i], "-n") && i + 2 < argc) show = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-H")) show = 0;
+        else usage();
+    }
+    if(i != argc - 1) usage();
+
+    n = load_dump(argv[i]);
+    if(n < 0) return 1;
+    if(n < TRACE_HDR_WORDS || words[0] != TRACE_MAGIC){
+        fprintf(stderr, "%s: no trace ring (magic 0x%04x, want 0x%04x)\n", argv[i],
+                n ? words[0] : 0, TRACE_MAGIC);
+        return 1;
+    }
+
+    len = words[1];
+    next = words[2];
+    stop = words[3];
+    count = words[4] | (UInt32)words[5] << 16;
+    mask = words[6];
+    if(len == 0 || next >= len || n < TRACE_HDR_WORDS + (long)len * TRACE_REC_WORDS){
+        fprintf(stderr, "%s: ring of %u records does not fit in %ld words\n", argv[i], len, n);
+        return 1;
+    }
+    kept = count < len ? count : len;
+
+    printf("%lu records written, last %lu kept, event mask 0x%04x, %s\n",
+           (unsigned long)count, (unsigned long)kept, mask,
+           stop == TRACE_RUN ? "running" : stop ? "freezing" : "frozen after a glitch");
+    if(show != 0) printf("\n%12s %10s  %-10s %6s %6s\n", "time us", "+us", "event", "a", "b");
+
+    for(e = 0; e < TRACE_EVENTS; e++) periods[e].name = event_names[e];
+
+    for(k = 0; k < kept; k++){
+        UInt16 slot = (UInt16)((count < len ? k : next + k) % len);
+        const UInt16 *r = &words[TRACE_HDR_WORDS + slot * TRACE_REC_WORDS];
+        UInt32 time = r[0] | (UInt32)r[1] << 16;
+        UInt16 seq = r[2], id = r[3], a = r[4], b = r[5];
+
+        // A record whose number is not the one its slot should hold was
+        // being written during the dump
+        if(seq != (UInt16)(count - kept + k) || id >= TRACE_EVENTS){
+            torn++;
+            continue;
+        }
+
+        // Timer 2 wraps every 21 s; the cycles between records do not
+        if(k - torn > 0) t += (UInt32)(time - time_prev);
+        time_prev = time;
+
+        if(show < 0 || k >= kept - show)
+            printf("%12.2f %10.2f  %-10s %6u %6u\n", t * 1e6 / SIM_CPU_HZ,
+                   (t - t_prev) * 1e6 / SIM_CPU_HZ, event_names[id], a, b);
+        t_prev = t;
+
+        if(seen[id]) hist_add(&periods[id], t - last_time[id]);
+        seen[id] = TRUE;
+        last_time[id] = t;
+
+        for(e = 0; e < NUM_LATENCIES; e++){
+            if(id == latencies[e].from){
+                open[e] = TRUE;
+                open_time[e] = t;
+            }
+            else if(id == latencies[e].to && open[e]){
+                hist_add(&latencies[e].h, t - open_time[e]);
+                open[e] = FALSE;
+            }
+        }
+    }
+    if(torn) printf("%lu records were being written and are left out\n", (unsigned long)torn);
+
+    printf("\nlatencies");
+    for(e = 0; e < NUM_LATENCIES; e++) hist_print(&latencies[e].h);
+    printf("\nintervals between records of the same event");
+    for(e = 0; e < TRACE_EVENTS; e++) hist_print(&periods[e]);
+
+    return 0;
+}
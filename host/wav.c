@@ -0,0 +1,149 @@
+/*
+ * wav.c
+ *
+ * Minimal RIFF/WAVE reader and writer for the host tools. See wav.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wav.h"
+
+static uint32_t rd32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static void wr32(uint8_t *p, uint32_t v)
+{
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static void wr16(uint8_t *p, uint16_t v)
+{
+    p[0] = v; p[1] = v >> 8;
+}
+
+int wav_read(const char *path, wav_data *wav)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t hdr[12], chunk[8], fmt[16];
+    uint16_t channels = 0, bits = 0, format = 0;
+    int have_fmt = 0;
+
+    memset(wav, 0, sizeof(*wav));
+    if(!f){
+        perror(path);
+        return -1;
+    }
+
+    if(fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4)){
+        fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    while(fread(chunk, 1, 8, f) == 8){
+        uint32_t size = rd32(chunk + 4);
+
+        if(!memcmp(chunk, "fmt ", 4) && size >= 16){
+            if(fread(fmt, 1, 16, f) != 16) break;
+            format = rd16(fmt);
+            channels = rd16(fmt + 2);
+            wav->rate = rd32(fmt + 4);
+            bits = rd16(fmt + 14);
+            have_fmt = 1;
+            fseek(f, (long)(size - 16 + (size & 1)), SEEK_CUR);
+        }
+        else if(!memcmp(chunk, "data", 4) && have_fmt){
+            size_t frames, i;
+            uint16_t c;
+            int16_t *raw;
+
+            if(format != 1 || bits != 16 || channels == 0){
+                fprintf(stderr, "%s: only 16-bit PCM is supported\n", path);
+                break;
+            }
+
+            frames = size / (2u * channels);
+            raw = malloc(frames * channels * sizeof(int16_t));
+            wav->samples = malloc((frames ? frames : 1) * sizeof(int16_t));
+            if(!raw || !wav->samples){
+                free(raw);
+                break;
+            }
+            frames = fread(raw, 2u * channels, frames, f);
+
+            // Mix down to mono
+            for(i = 0; i < frames; i++){
+                int32_t acc = 0;
+                for(c = 0; c < channels; c++){
+                    acc += (int16_t)rd16((const uint8_t *)&raw[i * channels + c]);
+                }
+                wav->samples[i] = (int16_t)(acc / channels);
+            }
+            wav->length = frames;
+            free(raw);
+            fclose(f);
+            return 0;
+        }
+        else{
+            fseek(f, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+    fprintf(stderr, "%s: no usable PCM data\n", path);
+    wav_free(wav);
+    fclose(f);
+    return -1;
+}
+
+int wav_write(const char *path, const int16_t *samples, size_t length, uint32_t rate)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t hdr[44];
+    size_t i;
+
+    if(!f){
+        perror(path);
+        return -1;
+    }
+
+    memcpy(hdr, "RIFF", 4);
+    wr32(hdr + 4, (uint32_t)(36 + length * 2));
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    wr32(hdr + 16, 16);
+    wr16(hdr + 20, 1); // PCM
+    wr16(hdr + 22, 1); // Mono
+    wr32(hdr + 24, rate);
+    wr32(hdr + 28, rate * 2);
+    wr16(hdr + 32, 2);
+    wr16(hdr + 34, 16);
+    memcpy(hdr + 36, "data", 4);
+    wr32(hdr + 40, (uint32_t)(length * 2));
+    fwrite(hdr, 1, sizeof(hdr), f);
+
+    for(i = 0; i < length; i++){
+        uint8_t s[2];
+        wr16(s, (uint16_t)samples[i]);
+        fwrite(s, 1, 2, f);
+    }
+
+    if(fclose(f) != 0){
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+void wav_free(wav_data *wav)
+{
+    free(wav->samples);
+    wav->samples = NULL;
+    wav->length = 0;
+}
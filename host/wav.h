@@ -0,0 +1,25 @@
+/*
+ * wav.h
+ *
+ * Minimal RIFF/WAVE reader and writer for the host tools. Reads 16-bit PCM
+ * with any channel count (mixed down to mono) and writes 16-bit mono PCM.
+ */
+
+#ifndef WAV_H_
+#define WAV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    int16_t *samples; // Mono samples, malloc'd by wav_read()
+    size_t length; // Number of samples
+    uint32_t rate; // Sample rate in Hz
+} wav_data;
+
+// Returns 0 on success, otherwise -1 with a message on stderr
+int wav_read(const char *path, wav_data *wav);
+int wav_write(const char *path, const int16_t *samples, size_t length, uint32_t rate);
+void wav_free(wav_data *wav);
+
+#endif /* WAV_H_ */
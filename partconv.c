@@ -0,0 +1,359 @@
+/*
+ * partconv.c
+ *
+ * Two-level partitioned overlap-save convolution, see partconv.h.
+ */
+
+#include <math.h>
+#include "partconv.h"
+
+#if 2 * CONV_TAIL_SPEC_LEN > DELAY_SEG_LEN
+#error "A tail spectrum does not fit in one delay_mem segment"
+#endif
+
+#if CONV_TAIL_STEPS < 3
+#error "CONV_TAIL_BLOCK must be at least 3 head blocks"
+#endif
+
+// cos and sin of pi*k/CONV_TAIL_BLOCK, filled by conv_init(). A size n
+// transform takes every (CONV_TAIL_BLOCK/n)th entry.
+static Float conv_cos[CONV_TAIL_BLOCK];
+static Float conv_sin[CONV_TAIL_BLOCK];
+
+static Float conv_acc[CONV_SPEC_LEN]; // Sum of the head partition products
+
+/* ======== conv_unit ======== */
+// Returns the head spectrum sized unit u of c's segments. The segments
+// are word arrays on 32-bit boundaries and every unit starts an even
+// number of words in.
+//
+static inline Float *conv_unit(const conv_part *c, UInt16 u)
+{
+    UInt16 *seg = c->seg[u >> c->spec_bits];
+
+    return (Float *)&seg[(u & ((1 << c->spec_bits) - 1)) * CONV_SPEC_WORDS];
+}
+
+// Tail spectrum s fills CONV_TAIL_STEPS units, which never cross a
+// segment; the head spectra follow the 2*tail_parts tail spectra.
+#define conv_tail(c, s) conv_unit(c, (s) * CONV_TAIL_STEPS)
+#define conv_head(c, s) conv_unit(c, 2 * (c)->tail_parts * CONV_TAIL_STEPS + (s))
+
+/* ======== conv_fft ======== */
+// In-place radix-2 decimation in time FFT of the n complex values in z
+// (real and imaginary parts interleaved). inv selects the inverse
+// transform, without the 1/n scale.
+//
+static void conv_fft(Float *z, UInt16 n, Bool inv)
+{
+    UInt16 i, j, k, len;
+
+    // Bit-reversed reordering
+    for(i = 1, j = 0; i < n; i++){
+        UInt16 bit = n >> 1;
+
+        for(; j & bit; bit >>= 1) j ^= bit;
+        j |= bit;
+
+        if(i < j){
+            Float tr = z[2*i], ti = z[2*i + 1];
+
+            z[2*i] = z[2*j]; z[2*i + 1] = z[2*j + 1];
+            z[2*j] = tr; z[2*j + 1] = ti;
+        }
+    }
+
+    // Butterflies; twiddle j of a span of len is e^-(2*pi*j/len)
+    for(len = 2; len <= n; len <<= 1){
+        UInt16 half = len >> 1;
+        UInt16 step = 2 * (CONV_TAIL_BLOCK / len);
+
+        for(j = 0; j < half; j++){
+            Float wr = conv_cos[j * step];
+            Float wi = inv ? conv_sin[j * step] : -conv_sin[j * step];
+
+            for(k = j; k < n; k += len){
+                Float *a = &z[2*k], *b = &z[2*(k + half)];
+                Float tr = wr*b[0] - wi*b[1];
+                Float ti = wr*b[1] + wi*b[0];
+
+                b[0] = a[0] - tr; b[1] = a[1] - ti;
+                a[0] += tr; a[1] += ti;
+            }
+        }
+    }
+}
+
+/* ======== conv_rfft ======== */
+// Replaces the 2*n real samples in x with their packed spectrum.
+// The even and odd samples are transformed together as one complex
+// sequence, then split into the two half spectra and combined.
+//
+static void conv_rfft(Float *x, UInt16 n)
+{
+    const UInt16 stride = CONV_TAIL_BLOCK / n;
+    UInt16 k;
+    Float r0;
+
+    conv_fft(x, n, FALSE);
+
+    // DC and Nyquist are both real
+    r0 = x[0];
+    x[0] = r0 + x[1];
+    x[1] = r0 - x[1];
+
+    // Bins k and n - k come from the same pair of values
+    for(k = 1; k <= n/2; k++){
+        Float *a = &x[2*k], *b = &x[2*(n - k)];
+        Float er = 0.5f*(a[0] + b[0]), ei = 0.5f*(a[1] - b[1]); // Even half
+        Float fr = 0.5f*(a[1] + b[1]), fi = 0.5f*(b[0] - a[0]); // Odd half
+        Float wr = conv_cos[k * stride], wi = -conv_sin[k * stride];
+        Float tr = wr*fr - wi*fi;
+        Float ti = wr*fi + wi*fr;
+
+        a[0] = er + tr; a[1] = ei + ti;
+        b[0] = er - tr; b[1] = ti - ei;
+    }
+}
+
+/* ======== conv_irfft ======== */
+// Inverse of conv_rfft, without its 1/(2*n) scale (conv_init folds that
+// into the IR spectra).
+//
+static void conv_irfft(Float *x, UInt16 n)
+{
+    const UInt16 stride = CONV_TAIL_BLOCK / n;
+    UInt16 k;
+    Float r0 = x[0];
+
+    x[0] = r0 + x[1];
+    x[1] = r0 - x[1];
+
+    for(k = 1; k <= n/2; k++){
+        Float *a = &x[2*k], *b = &x[2*(n - k)];
+        Float er = a[0] + b[0], ei = a[1] - b[1];
+        Float dr = a[0] - b[0], di = a[1] + b[1];
+        Float wr = conv_cos[k * stride], wi = conv_sin[k * stride];
+        Float fr = wr*dr - wi*di; // Odd half
+        Float fi = wr*di + wi*dr;
+
+        a[0] = er - fi; a[1] = ei + fr;
+        b[0] = er + fi; b[1] = fr - ei;
+    }
+
+    conv_fft(x, n, TRUE);
+}
+
+/* ======== conv_irSpec ======== */
+// Fills h with the spectrum of the n taps of ir, zero padded to 2*n
+// and scaled for conv_irfft.
+//
+static void conv_irSpec(Float *h, const Float *ir, UInt16 n)
+{
+    UInt16 t;
+
+    for(t = 0; t < n; t++){
+        h[t] = ir[t] * (0.5f / n);
+        h[t + n] = 0;
+    }
+    conv_rfft(h, n);
+}
+
+/* ======== conv_window ======== */
+// Fills x with the newest 2*n input samples of c, oldest first.
+//
+static void conv_window(const conv_part *c, Float *x, UInt16 n)
+{
+    UInt16 i = (c->hist_i - 2*n) & (CONV_HEAD_TAPS - 1);
+    UInt16 k;
+
+    for(k = 0; k < 2*n; k++){
+        x[k] = (Float)c->hist[i];
+        i = (i + 1) & (CONV_HEAD_TAPS - 1);
+    }
+}
+
+/* ======== conv_mac ======== */
+// Adds the product of the packed spectra a and h of 2*n Floats to acc.
+//
+static inline void conv_mac(Float *acc, const Float *a, const Float *h, UInt16 n)
+{
+    UInt16 k;
+
+    acc[0] += a[0] * h[0];
+    acc[1] += a[1] * h[1];
+    for(k = 2; k < 2*n; k += 2){
+        acc[k] += a[k]*h[k] - a[k + 1]*h[k + 1];
+        acc[k + 1] += a[k]*h[k + 1] + a[k + 1]*h[k];
+    }
+}
+
+/* ======== conv_tailStep ======== */
+// Does this head block's share of the tail: the output for the next
+// tail block is the sum over the tail partitions q of partition q and
+// the input window from q tail blocks ago, the newest of which ends
+// where the current tail block starts.
+//
+static void conv_tailStep(conv_part *c)
+{
+    const UInt16 parts = c->tail_parts;
+    const UInt16 step = c->step;
+    UInt16 q, end, k;
+
+    if(parts == 0) return;
+
+    if(step == 0){
+        // Transform the window before the current tail block into the
+        // next delay line slot
+        Float *x;
+
+        c->tail = (c->tail + 1 == parts) ? 0 : c->tail + 1;
+        x = conv_tail(c, c->tail);
+        conv_window(c, x, CONV_TAIL_BLOCK);
+        conv_rfft(x, CONV_TAIL_BLOCK);
+
+        for(k = 0; k < CONV_TAIL_SPEC_LEN; k++) c->tail_acc[k] = 0;
+    } else if(step < CONV_TAIL_STEPS - 1){
+        // The steps between share the partitions evenly
+        q = (UInt32)(step - 1) * parts / (CONV_TAIL_STEPS - 2);
+        end = (UInt32)step * parts / (CONV_TAIL_STEPS - 2);
+
+        for(; q < end; q++){
+            UInt16 s = (c->tail >= q) ? c->tail - q : c->tail + parts - q;
+
+            conv_mac(c->tail_acc, conv_tail(c, s), conv_tail(c, parts + q), CONV_TAIL_BLOCK);
+        }
+    } else {
+        conv_irfft(c->tail_acc, CONV_TAIL_BLOCK);
+    }
+}
+
+/* ======== conv_block ======== */
+// Convolves the CONV_BLOCK samples of x into y (which may alias x).
+//
+static void conv_block(conv_part *c, Int16 *y, const Int16 *x)
+{
+    const UInt16 mask = c->head_parts - 1;
+    UInt16 head, p, k;
+    Float *a;
+
+    conv_tailStep(c);
+
+    for(k = 0; k < CONV_BLOCK; k++){
+        c->hist[c->hist_i] = x[k];
+        c->hist_i = (c->hist_i + 1) & (CONV_HEAD_TAPS - 1);
+    }
+
+    // Transform the window of the previous and this block into the next
+    // head delay line slot
+    head = (c->head + 1) & mask;
+    c->head = head;
+    a = conv_head(c, head);
+    conv_window(c, a, CONV_BLOCK);
+    conv_rfft(a, CONV_BLOCK);
+
+    for(k = 0; k < CONV_SPEC_LEN; k++) conv_acc[k] = 0;
+
+    // Partition p of the IR meets the input spectrum from p blocks ago
+    for(p = 0; p < c->head_parts; p++)
+        conv_mac(conv_acc, conv_head(c, (head - p) & mask), conv_head(c, c->head_parts + p), CONV_BLOCK);
+
+    conv_irfft(conv_acc, CONV_BLOCK);
+
+    // The first half is wrapped around by the circular convolution
+    a = &c->tail_out[c->step * CONV_BLOCK];
+    for(k = 0; k < CONV_BLOCK; k++) y[k] = audio_sat((Int32)(conv_acc[CONV_BLOCK + k] + a[k]));
+
+    if(++c->step == CONV_TAIL_STEPS){
+        c->step = 0;
+        if(c->tail_parts != 0)
+            for(k = 0; k < CONV_TAIL_BLOCK; k++) c->tail_out[k] = c->tail_acc[CONV_TAIL_BLOCK + k];
+    }
+}
+
+/* ======== conv_init ======== */
+Bool conv_init(conv_part *c, UInt16 **seg, UInt16 nseg, const Float *ir, UInt16 len)
+{
+    UInt16 k, p;
+    UInt16 bits = 0;
+
+    for(k = 0; k < CONV_TAIL_BLOCK; k++){
+        conv_cos[k] = cosf(3.14159265f * k / CONV_TAIL_BLOCK);
+        conv_sin[k] = sinf(3.14159265f * k / CONV_TAIL_BLOCK);
+    }
+
+    while((CONV_SPEC_WORDS << (bits + 1)) <= DELAY_SEG_LEN) bits++;
+
+    c->seg = seg;
+    c->spec_bits = bits;
+    c->head_parts = (len < CONV_HEAD_TAPS ? len : CONV_HEAD_TAPS) / CONV_BLOCK;
+    c->tail_parts = (len > CONV_HEAD_TAPS) ? (len - CONV_HEAD_TAPS) / CONV_TAIL_BLOCK : 0;
+
+    // The delay line and IR spectra of both levels need 8*len words
+    if(seg == NULL || len < CONV_BLOCK || (len & (len - 1)) != 0 ||
+       2L * c->tail_parts * CONV_TAIL_STEPS + 2 * c->head_parts > ((UInt32)nseg << bits)){
+        c->head_parts = 0;
+        c->tail_parts = 0;
+        return FALSE;
+    }
+
+    // Each partition is zero padded to twice its length before its transform
+    for(p = 0; p < c->head_parts; p++)
+        conv_irSpec(conv_head(c, c->head_parts + p), &ir[p * CONV_BLOCK], CONV_BLOCK);
+    for(p = 0; p < c->tail_parts; p++)
+        conv_irSpec(conv_tail(c, c->tail_parts + p), &ir[CONV_HEAD_TAPS + p * CONV_TAIL_BLOCK], CONV_TAIL_BLOCK);
+
+    conv_reset(c);
+
+    return TRUE;
+}
+
+/* ======== conv_reset ======== */
+void conv_reset(conv_part *c)
+{
+    UInt16 p, k;
+
+    for(p = 0; p < c->head_parts; p++){
+        Float *x = conv_head(c, p);
+
+        for(k = 0; k < CONV_SPEC_LEN; k++) x[k] = 0;
+    }
+    for(p = 0; p < c->tail_parts; p++){
+        Float *x = conv_tail(c, p);
+
+        for(k = 0; k < CONV_TAIL_SPEC_LEN; k++) x[k] = 0;
+    }
+
+    for(k = 0; k < CONV_HEAD_TAPS; k++) c->hist[k] = 0;
+    for(k = 0; k < CONV_BLOCK; k++) c->out[k] = 0;
+    for(k = 0; k < CONV_TAIL_BLOCK; k++) c->tail_out[k] = 0;
+    c->head = 0;
+    c->tail = 0;
+    c->step = 0;
+    c->hist_i = 0;
+    c->fill = 0;
+}
+
+/* ======== conv_process ======== */
+void conv_process(conv_part *c, Int16 *y, const Int16 *x, UInt16 n)
+{
+    UInt16 i;
+
+    if(c->head_parts == 0) return;
+
+    if(n >= CONV_BLOCK){
+        for(i = 0; i < n; i += CONV_BLOCK) conv_block(c, &y[i], &x[i]);
+        return;
+    }
+
+    // Gather short frames into a block. The frame that completes it
+    // takes the start of its output and the following frames the rest,
+    // so every sample comes out CONV_BLOCK - n late.
+    for(i = 0; i < n; i++) c->in[c->fill + i] = x[i];
+    c->fill += n;
+    if(c->fill == CONV_BLOCK){
+        conv_block(c, c->out, c->in);
+        c->fill = 0;
+    }
+    for(i = 0; i < n; i++) y[i] = c->out[c->fill + i];
+}
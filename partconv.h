@@ -0,0 +1,101 @@
+/*
+ * partconv.h
+ *
+ * Two-level partitioned overlap-save convolution for long impulse
+ * responses (cabinet IRs of 1024-4096 taps).
+ *
+ * The head of the IR, its first CONV_HEAD_TAPS taps, is cut into short
+ * partitions of CONV_BLOCK samples. Every CONV_BLOCK input samples cost
+ * one real FFT of the newest 2*CONV_BLOCK samples, one complex
+ * multiply-add per bin and head partition against the spectra of past
+ * blocks (the frequency domain delay line) and one inverse real FFT.
+ *
+ * The rest of the IR, the tail, is cut into partitions of
+ * CONV_TAIL_BLOCK samples, handled the same way once per tail block.
+ * Because the tail starts 2*CONV_TAIL_BLOCK taps in, its output for a
+ * tail block is not needed until one whole tail block after its input
+ * is complete. That work is spread over the CONV_TAIL_STEPS head blocks
+ * of the following tail block:
+ *
+ * - the first step runs the forward FFT;
+ * - the steps between share the tail partitions evenly;
+ * - the last step runs the inverse FFT.
+ *
+ * No block ever runs a whole tail transform, and the tail adds no
+ * latency.
+ *
+ * Per sample, the head costs the same for every IR; only the tail grows,
+ * by one partition's multiply-adds per CONV_TAIL_BLOCK taps. That is an
+ * eighth of the growth of uniform CONV_BLOCK partitions, so 4096 taps
+ * cost about twice what 1024 taps do rather than four times (pedal_bench
+ * checks the ratio).
+ *
+ * Frames of CONV_BLOCK samples or more are processed a block at a time
+ * with no added latency. Shorter frames are gathered into a block, which
+ * delays the output by CONV_LATENCY(n) samples, and every
+ * CONV_BLOCK / n frames runs one block's work.
+ *
+ * The real FFTs of 2*n points run as an n-point complex radix-2 FFT plus
+ * a split step, with the twiddles in one table of CONV_TAIL_BLOCK cosines
+ * and sines. Spectra are packed into 2*n Floats: bin 0 holds DC in its
+ * real part and Nyquist in its imaginary part.
+ *
+ * The IR and delay line spectra take 8*len words (32768 for 4096 taps),
+ * so they live in delay_mem segments. The tail spectra come first, then
+ * the head spectra. No spectrum straddles two segments, and each is
+ * found through the segment table like a delay_long sample.
+ */
+
+#ifndef PARTCONV_H_
+#define PARTCONV_H_
+
+#include <xdc/std.h>
+#include <delay_mem.h>
+#include <EffectsPedal_audio.h>
+
+#define CONV_BLOCK 16 // Head partition length in samples
+#define CONV_TAIL_BLOCK 128 // Tail partition length in samples
+#define CONV_TAIL_STEPS (CONV_TAIL_BLOCK / CONV_BLOCK) // Head blocks per tail block
+#define CONV_HEAD_TAPS (2 * CONV_TAIL_BLOCK) // Taps before the tail starts
+#define CONV_SPEC_LEN (2 * CONV_BLOCK) // Floats per head spectrum
+#define CONV_SPEC_WORDS (2 * CONV_SPEC_LEN) // 16-bit words per head spectrum
+#define CONV_TAIL_SPEC_LEN (2 * CONV_TAIL_BLOCK) // Floats per tail spectrum
+
+// Segments for the spectra of an IR of len taps
+#define CONV_SEGS(len) ((8L * (len) + DELAY_SEG_LEN - 1) / DELAY_SEG_LEN)
+
+// Samples by which frames of n samples come out late
+#define CONV_LATENCY(n) ((n) < CONV_BLOCK ? CONV_BLOCK - (n) : 0)
+
+typedef struct {
+    UInt16 **seg; // Segment table; tail spectra first, then the head's
+    UInt16 spec_bits; // log2 of the head spectra per segment
+    UInt16 head_parts; // Head partitions, a power of two
+    UInt16 tail_parts; // Tail partitions, 0 if the IR is all head
+    UInt16 head; // Head delay line slot of the newest input spectrum
+    UInt16 tail; // Tail delay line slot of the newest input spectrum
+    UInt16 step; // Head blocks done in the current tail block
+    UInt16 hist_i; // Slot of the oldest sample in hist, overwritten next
+    UInt16 fill; // Samples of a short frame gathered into in
+    Int16 hist[CONV_HEAD_TAPS]; // Newest 2*CONV_TAIL_BLOCK input samples, circular
+    Int16 in[CONV_BLOCK]; // Short frames gathered into a block
+    Int16 out[CONV_BLOCK]; // and that block's output
+    Float tail_acc[CONV_TAIL_SPEC_LEN]; // Sum of the tail partition products
+    Float tail_out[CONV_TAIL_BLOCK]; // Tail output for the current tail block
+} conv_part;
+
+// Prepares c to convolve with the len taps of ir (a power of two of
+// CONV_BLOCK or more) using nseg segments from delay_segAlloc().
+// Returns FALSE if the IR does not fit.
+Bool conv_init(conv_part *c, UInt16 **seg, UInt16 nseg, const Float *ir, UInt16 len);
+
+// Clears the input history and the delay line spectra, leaving the IR
+// in place
+void conv_reset(conv_part *c);
+
+// Convolves a frame of n input samples x (a power of two; a multiple of
+// CONV_BLOCK if larger) and saturates n output samples, CONV_LATENCY(n)
+// samples late, into y (which may alias x).
+void conv_process(conv_part *c, Int16 *y, const Int16 *x, UInt16 n);
+
+#endif /* PARTCONV_H_ */
@@ -0,0 +1,166 @@
+/*
+ * thread_prof.c
+ *
+ * Per-thread CPU profiler on CPU timer 2, see thread_prof.h.
+ */
+
+#include <ti/sysbios/hal/Hwi.h>
+#include <Headers/F2837xD_device.h>
+#include "thread_prof.h"
+
+typedef struct {
+    UInt32 runs, sum, min, max; // Runs that ended in the window
+    UInt32 busy; // Own time in the window, including unfinished runs
+    UInt32 cur; // Own time of the run in progress
+} prof_acc;
+
+volatile prof_stats prof_stat;
+
+const char * const prof_names[PROF_THREADS] = {
+    "audioIn_hwi", "audioDma_hwi", "tickFxn", "effectIn1_hwi",
+    "audioOut_swi", "gpio_effect_task", "idle"
+};
+
+static prof_acc prof_accs[PROF_THREADS];
+static UInt16 prof_stack[PROF_THREADS]; // Threads by preemption, idle at the bottom
+static UInt16 prof_depth;
+static UInt32 prof_mark; // Time up to which the top of the stack is charged
+static UInt32 prof_start; // Start of the window
+static UInt16 prof_ticks; // Ticks in the window
+
+/* ======== prof_charge ======== */
+// Charges the time since the last call to the thread on top
+static inline void prof_charge(void)
+{
+    UInt32 now = PROF_NOW();
+    prof_acc *a = &prof_accs[prof_stack[prof_depth - 1]];
+
+    a->cur += now - prof_mark;
+    a->busy += now - prof_mark;
+    prof_mark = now;
+}
+
+/* ======== prof_end ======== */
+// Ends the run in progress of a thread
+static inline void prof_end(prof_acc *a)
+{
+    a->runs++;
+    a->sum += a->cur;
+    if(a->cur < a->min) a->min = a->cur;
+    if(a->cur > a->max) a->max = a->cur;
+    a->cur = 0;
+}
+
+/* ======== prof_clear ======== */
+// Starts a new window, keeping the runs in progress
+static void prof_clear(void)
+{
+    UInt16 i;
+
+    for(i = 0; i < PROF_THREADS; i++){
+        prof_accs[i].runs = prof_accs[i].sum = prof_accs[i].max = prof_accs[i].busy = 0;
+        prof_accs[i].min = 0xFFFFFFFF;
+    }
+    prof_start = prof_mark;
+    prof_ticks = 0;
+}
+
+/* ======== prof_init ======== */
+void prof_init(void)
+{
+    UInt16 i;
+
+    // Free-running down count at SYSCLK that stops at a breakpoint
+    CpuTimer2Regs.TCR.bit.TSS = 1;
+    CpuTimer2Regs.PRD.all = 0xFFFFFFFF;
+    CpuTimer2Regs.TPR.all = 0;
+    CpuTimer2Regs.TPRH.all = 0;
+    CpuTimer2Regs.TCR.bit.TIE = 0;
+    CpuTimer2Regs.TCR.bit.SOFT = 0;
+    CpuTimer2Regs.TCR.bit.FREE = 0;
+    CpuTimer2Regs.TCR.bit.TRB = 1;
+    CpuTimer2Regs.TCR.bit.TSS = 0;
+
+    for(i = 0; i < PROF_THREADS; i++) prof_accs[i].cur = 0;
+    prof_stack[0] = PROF_IDLE;
+    prof_depth = 1;
+    prof_mark = PROF_NOW();
+    prof_clear();
+
+    prof_stat.window = 0;
+    prof_stat.windows = 0;
+    for(i = 0; i < PROF_THREADS; i++){
+        prof_stat.thread[i].runs = prof_stat.thread[i].min = 0;
+        prof_stat.thread[i].mean = prof_stat.thread[i].max = 0;
+        prof_stat.thread[i].load = 0;
+    }
+}
+
+#if PROF_ENABLE
+
+/* ======== prof_enter ======== */
+// Interrupts are masked so that an Hwi arriving in the middle of the
+// Swi's or the task's call cannot see the stack half updated.
+//
+void prof_enter(prof_id id)
+{
+    UInt key = Hwi_disable();
+
+    prof_charge();
+    if(prof_depth == 1) prof_end(&prof_accs[PROF_IDLE]); // Idle preempted
+    if(prof_depth < PROF_THREADS) prof_stack[prof_depth++] = id;
+    Hwi_restore(key);
+}
+
+/* ======== prof_exit ======== */
+void prof_exit(prof_id id)
+{
+    UInt key = Hwi_disable();
+
+    prof_charge();
+    if(prof_depth > 1 && prof_stack[prof_depth - 1] == id){
+        prof_end(&prof_accs[id]);
+        prof_depth--;
+    }
+    Hwi_restore(key);
+}
+
+/* ======== prof_tick ======== */
+// Closes the window every PROF_WINDOW_TICKS ticks. Runs in tickFxn,
+// which the audio and knob Hwis can preempt, so the accumulators are
+// copied and cleared with interrupts masked and the results are worked
+// out from the copy afterwards.
+//
+void prof_tick(void)
+{
+    static prof_acc copy[PROF_THREADS]; // Off the Hwi stack
+    UInt32 window, per;
+    UInt16 i;
+    UInt key;
+
+    if(++prof_ticks < PROF_WINDOW_TICKS) return;
+
+    key = Hwi_disable();
+    prof_charge();
+    for(i = 0; i < PROF_THREADS; i++) copy[i] = prof_accs[i];
+    window = prof_mark - prof_start;
+    prof_clear();
+    Hwi_restore(key);
+
+    per = window / 10000 + 1; // Cycles per 0.01 % of load
+
+    for(i = 0; i < PROF_THREADS; i++){
+        const prof_acc *a = &copy[i];
+        volatile prof_thread *r = &prof_stat.thread[i];
+
+        r->runs = a->runs;
+        r->min = a->runs ? a->min : 0;
+        r->mean = a->runs ? a->sum / a->runs : 0;
+        r->max = a->max;
+        r->load = (UInt16)(a->busy / per);
+    }
+    prof_stat.window = window;
+    prof_stat.windows++;
+}
+
+#endif /* PROF_ENABLE */
@@ -0,0 +1,96 @@
+/*
+ * thread_prof.h
+ *
+ * Per-thread CPU profiler. Every profiled thread calls prof_enter() as
+ * it starts and prof_exit() as it ends, and each call reads CPU timer 2,
+ * which prof_init() sets free-running at SYSCLK (5 ns). The threads are
+ * kept on a stack in the order they preempted each other, so the time
+ * between two calls is charged to the thread on top: every thread is
+ * charged only its own cycles, never those of the Hwis or Swi that
+ * preempted it. Whatever no thread claims (the idle loop and the BIOS
+ * scheduler) is charged to PROF_IDLE, which sits at the bottom of the
+ * stack; an idle "run" is one stretch between preemptions.
+ *
+ * prof_tick() is called from tickFxn and closes a window every
+ * PROF_WINDOW_TICKS ticks. The per-run min/mean/max and the load of
+ * every thread over the last window are then copied to prof_stat, which
+ * the debugger (Expressions view or ROV) can watch while running.
+ *
+ * The Hwi dispatcher's entry and exit are outside prof_enter() and
+ * prof_exit(), so they show up as idle. Host builds replace the timer
+ * read with the simulated timer in host/pedal_sim.c (see c28x_host.h).
+ */
+
+#ifndef THREAD_PROF_H_
+#define THREAD_PROF_H_
+
+#include <xdc/std.h>
+
+// Set to 0 to compile the enter, exit and tick calls out (prof_stat then
+// stays zero). Each pair costs a few dozen cycles per run, about 1 % of
+// the sample period for audioIn_hwi.
+#ifndef PROF_ENABLE
+#define PROF_ENABLE 1
+#endif
+
+// Length of a profiling window in 10 ms ticks
+#ifndef PROF_WINDOW_TICKS
+#define PROF_WINDOW_TICKS 100
+#endif
+
+#if PROF_WINDOW_TICKS < 1 || PROF_WINDOW_TICKS > 1000
+#error "PROF_WINDOW_TICKS must be 1 to 1000"
+#endif
+
+// Cycles since prof_init() started the timer; CPU timer 2 counts down
+// from 0xFFFFFFFF. Also the timestamp of the trace ring (trace.h).
+#ifndef PROF_NOW
+#define PROF_NOW() (~CpuTimer2Regs.TIM.all)
+#endif
+
+typedef enum {
+    PROF_AUDIO_IN, // audioIn_hwi
+    PROF_AUDIO_DMA, // audioDma_hwi
+    PROF_TICK, // tickFxn
+    PROF_KNOB, // effectIn1_hwi
+    PROF_AUDIO_OUT, // audioOut_swi
+    PROF_TASK, // gpio_effect_task
+    PROF_IDLE, // Idle loop and anything else
+    PROF_THREADS
+} prof_id;
+
+typedef struct {
+    UInt32 runs; // Runs that ended in the window
+    UInt32 min; // Shortest run, cycles of the thread's own time
+    UInt32 mean;
+    UInt32 max;
+    UInt16 load; // Own time as a share of the window, in 0.01 %
+} prof_thread;
+
+typedef struct {
+    UInt32 window; // Length of the last window in cycles
+    UInt32 windows; // Windows closed since prof_init(), bumped last
+    prof_thread thread[PROF_THREADS];
+} prof_stats;
+
+extern volatile prof_stats prof_stat; // Results of the last window
+extern const char * const prof_names[PROF_THREADS];
+
+// Starts CPU timer 2 and clears the profile. Called from main() after
+// DeviceInit() and before BIOS_start().
+void prof_init(void);
+
+#if PROF_ENABLE
+// Marks the start and end of a run of thread id
+void prof_enter(prof_id id);
+void prof_exit(prof_id id);
+
+// Counts a 10 ms tick and closes the window after PROF_WINDOW_TICKS
+void prof_tick(void);
+#else
+#define prof_enter(id) ((void)0)
+#define prof_exit(id) ((void)0)
+#define prof_tick() ((void)0)
+#endif
+
+#endif /* THREAD_PROF_H_ */
@@ -0,0 +1,37 @@
+/*
+ * trace.c
+ *
+ * Binary trace ring in RAMGS15, see trace.h.
+ */
+
+#include "trace.h"
+#include "delay_mem.h"
+
+// trace_ring has RAMGS15 to itself, one delay_mem segment's worth
+#if TRACE_WORDS > DELAY_SEG_LEN
+#error "The trace ring does not fit in RAMGS15"
+#endif
+
+#pragma DATA_SECTION(trace, "trace_ring")
+volatile trace_buf trace;
+
+/* ======== trace_init ======== */
+void trace_init(void)
+{
+    UInt16 i;
+
+    trace.magic = 0;
+    for(i = 0; i < TRACE_LEN; i++){
+        trace.rec[i].time = 0;
+        trace.rec[i].seq = i ^ 0x8000; // Never the number of its first record
+        trace.rec[i].id = 0;
+        trace.rec[i].a = trace.rec[i].b = 0;
+    }
+    trace.len = TRACE_LEN;
+    trace.next = 0;
+    trace.count = 0;
+    trace.mask = (1 << TRACE_EVENTS) - 1;
+    trace.rsvd = 0;
+    trace.stop = TRACE_RUN;
+    trace.magic = TRACE_MAGIC;
+}
@@ -0,0 +1,135 @@
+/*
+ * trace.h
+ *
+ * Binary trace ring for post-mortem analysis of the audio path. Every
+ * record is six words: the CPU timer 2 timestamp (thread_prof.h), the
+ * low 16 bits of its record number, an event id and two arguments.
+ * trace_log() masks interrupts only to take the timestamp and claim a
+ * slot and fills the slot in afterwards, so a writer never waits for
+ * another and an Hwi can log in the middle of the Swi's record. The
+ * record number is written last: a record that was still being written
+ * when the memory was dumped has a stale number and the decoder drops it.
+ *
+ * The ring (section trace_ring, placed in RAMGS15 by TMS320F28379D.cmd)
+ * fills that block with TRACE_LEN records, about 70 ms with every event
+ * enabled, and stays out of .ebss in LS05SARAM. Clearing
+ * the per-frame events from trace.mask stretches it to seconds of knob,
+ * chain and error events. A drop or late Swi freezes the ring
+ * TRACE_FREEZE records later, so what led up to the first glitch stays
+ * in memory until trace_init() or a write of 0xFFFF to trace.stop.
+ *
+ * Dump it with CCS (Memory Browser, Save Memory of TRACE_WORDS words,
+ * 0xFFE, from 0x1B000, TI data or raw binary) and decode it on Linux
+ * with host/pedal_trace, which prints the timeline and latency
+ * histograms.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <xdc/std.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <Headers/F2837xD_device.h>
+#include <thread_prof.h>
+
+// Set to 0 to compile trace_log() out
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE 1
+#endif
+
+#define TRACE_LEN 681 // Records, as many as fit in RAMGS15
+#define TRACE_HDR_WORDS 8 // Words of the header before the records
+#define TRACE_REC_WORDS 6 // Words per record
+#define TRACE_WORDS (TRACE_HDR_WORDS + TRACE_LEN * TRACE_REC_WORDS) // 4094 of 4096
+#define TRACE_MAGIC 0x7ACE
+
+// Records kept after the first drop or late Swi before the ring stops
+// (0 to never stop)
+#ifndef TRACE_FREEZE
+#define TRACE_FREEZE (TRACE_LEN / 4)
+#endif
+
+#if TRACE_FREEZE < 0 || TRACE_FREEZE >= TRACE_LEN
+#error "TRACE_FREEZE must be 0 to TRACE_LEN - 1"
+#endif
+
+#define TRACE_RUN 0xFFFF // trace.stop while the ring runs on
+
+// Event ids (at most 16, one bit each in trace.mask) and their arguments
+typedef enum {
+    TRACE_FRAME, // audio Hwi handed a frame to the Swi: half, write index
+    TRACE_SWI_BEGIN, // audioOut_swi started: backlog in samples, half
+    TRACE_SWI_END, // audioOut_swi ended: samples stored since its frame, 0
+    TRACE_DROP, // Frames overwritten before the Swi took them: samples, backlog
+    TRACE_LATE, // Swi ended after the next frame: samples stored since its frame, 0
+    TRACE_TICK, // tickFxn: tick count, 0
+    TRACE_KNOB, // effectIn1_hwi: averaged knob, latest reading
+    TRACE_PUBLISH, // gpio_effect_task published a chain: slot mask, fade
+    TRACE_ADOPT, // audioOut_swi took a published chain: generation, fade
+    TRACE_LATENCY, // Latency measurement ended (audio_lat): samples, peak in DAC codes
+    TRACE_EVENTS
+} trace_event;
+
+typedef struct {
+    UInt32 time; // CPU timer 2 cycles
+    UInt16 seq; // Low bits of the record number, written last
+    UInt16 id; // trace_event
+    UInt16 a, b; // Arguments
+} trace_rec;
+
+typedef struct {
+    UInt16 magic; // TRACE_MAGIC once trace_init() has run
+    UInt16 len; // TRACE_LEN
+    UInt16 next; // Slot of the next record
+    UInt16 stop; // Records left before the ring freezes, or TRACE_RUN
+    UInt32 count; // Records claimed since trace_init()
+    UInt16 mask; // Events recorded, bit (1 << id)
+    UInt16 rsvd;
+    trace_rec rec[TRACE_LEN];
+} trace_buf;
+
+extern volatile trace_buf trace;
+
+// Clears the ring and enables every event. Called from main() after
+// prof_init(), which starts the timestamp.
+void trace_init(void);
+
+#if TRACE_ENABLE
+
+/* ======== trace_log ======== */
+// Appends one record if id is enabled and the ring has not frozen.
+// Safe from any thread.
+//
+static inline void trace_log(trace_event id, UInt16 a, UInt16 b)
+{
+    volatile trace_rec *r;
+    UInt32 n, t;
+    UInt key;
+
+    if(!(trace.mask & (1 << id))) return;
+
+    key = Hwi_disable();
+    if(trace.stop == 0){
+        Hwi_restore(key);
+        return;
+    }
+    if(trace.stop != TRACE_RUN) trace.stop--;
+    else if(TRACE_FREEZE && (id == TRACE_DROP || id == TRACE_LATE)) trace.stop = TRACE_FREEZE;
+    t = PROF_NOW();
+    n = trace.count++;
+    r = &trace.rec[trace.next];
+    if(++trace.next == TRACE_LEN) trace.next = 0;
+    Hwi_restore(key);
+
+    r->time = t;
+    r->id = id;
+    r->a = a;
+    r->b = b;
+    r->seq = (UInt16)n;
+}
+
+#else
+#define trace_log(id, a, b) ((void)0)
+#endif
+
+#endif /* TRACE_H_ */